@@ -21,6 +21,7 @@ end
 module Pod
   require 'pathname'
   require 'tmpdir'
+  require 'stringio'
 
   require 'cocoapods/gem_version'
   require 'cocoapods/version_metadata'
@@ -62,6 +63,7 @@ module Pod
     autoload :Markdown,                'cocoapods/generator/acknowledgements/markdown'
     autoload :Plist,                   'cocoapods/generator/acknowledgements/plist'
     autoload :BridgeSupport,           'cocoapods/generator/bridge_support'
+    autoload :ChangedFileWriter,       'cocoapods/generator/changed_file_writer'
     autoload :Constant,                'cocoapods/generator/constant'
     autoload :ScriptPhaseConstants,    'cocoapods/generator/script_phase_constants'
     autoload :CopyResourcesScript,     'cocoapods/generator/copy_resources_script'
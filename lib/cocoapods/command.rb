@@ -16,6 +16,7 @@ module Pod
   class Command < CLAide::Command
     require 'cocoapods/command/options/repo_update'
     require 'cocoapods/command/options/project_directory'
+    require 'cocoapods/command/options/timings'
     include Options
 
     require 'cocoapods/command/cache'
@@ -13,13 +13,27 @@ module Pod
         or cleaning the pods cache.
       DESC
 
+      def self.options
+        [
+          ['--rebuild-index', 'Rebuild the index of the cache from the cached podspecs first'],
+        ].concat(super)
+      end
+
       def initialize(argv)
         @cache = Downloader::Cache.new(Config.instance.cache_root + 'Pods')
+        @rebuild_index = argv.flag?('rebuild-index')
         super
       end
 
       private
 
+      def rebuild_index_if_needed
+        return unless @rebuild_index
+        UI.message("Rebuilding the index of #{@cache.root}") do
+          @cache.rebuild_index
+        end
+      end
+
       def pod_type(pod_cache_descriptor)
         pod_cache_descriptor[:release] ? 'Release' : 'External'
       end
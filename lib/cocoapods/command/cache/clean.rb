@@ -7,6 +7,9 @@ module Pod
         self.description = <<-DESC
           Remove the cache for a given pod, or clear the cache completely.
 
+          With `--max-size`, the least recently used pods are removed until
+          the cache is no larger than the given size, such as `10G`.
+
           If there is multiple cache for various versions of the requested pod,
           you will be asked which one to clean. Use `--all` to clean them all.
 
@@ -19,19 +22,24 @@ module Pod
         ]
 
         def self.options
-          [[
-            '--all', 'Remove all the cached pods without asking'
-          ]].concat(super)
+          [
+            ['--all', 'Remove all the cached pods without asking'],
+            ['--max-size=SIZE', 'Remove the least recently used pods until the cache is no larger than SIZE'],
+          ].concat(super)
         end
 
         def initialize(argv)
           @pod_name = argv.shift_argument
           @wipe_all = argv.flag?('all')
+          @max_size = argv.option('max-size')
           super
         end
 
         def run
-          if @pod_name.nil?
+          rebuild_index_if_needed
+          if @max_size
+            evict_least_recently_used
+          elsif @pod_name.nil?
             # Note: at that point, @wipe_all is always true (thanks to `validate!`)
             # Remove all
             clear_cache
@@ -54,10 +62,13 @@ module Pod
 
         def validate!
           super
-          if @pod_name.nil? && !@wipe_all
+          if @pod_name.nil? && !@wipe_all && !@max_size
             # Security measure, to avoid removing the pod cache too agressively by mistake
             help! 'You should either specify a pod name or use the --all flag'
           end
+          if @max_size && (@pod_name || @wipe_all)
+            help! 'The --max-size option can not be combined with a pod name or the --all flag'
+          end
         end
 
         private
@@ -74,7 +85,24 @@ module Pod
               FileUtils.rm(desc[:spec_file])
             end
             UI.message("Removing cache #{desc[:slug]}") do
-              FileUtils.rm_rf(desc[:slug])
+              # Waits for the processes publishing the Pod to the cache.
+              Downloader::Cache.write_lock(desc[:slug]) do
+                @cache.discard(desc[:slug])
+                @cache.remove_manifest(desc[:slug])
+                @cache.remove_from_index(desc[:slug])
+              end
+            end
+          end
+          UI.message('Removing unused blobs') do
+            @cache.remove_unused_blobs
+          end
+        end
+
+        def evict_least_recently_used
+          max_size = Downloader::Cache.parse_size(@max_size)
+          UI.message("Evicting the least recently used pods above #{@max_size}") do
+            @cache.evict(max_size).each do |slug|
+              UI.message("Removed cache #{slug}")
             end
           end
         end
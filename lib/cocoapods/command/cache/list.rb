@@ -26,6 +26,7 @@ module Pod
         end
 
         def run
+          rebuild_index_if_needed
           UI.puts("$CACHE_ROOT: #{@cache.root}") if @short_output
           if @pod_name.nil? # Print all
             @cache.cache_descriptors_per_pod.each do |pod_name, cache_descriptors|
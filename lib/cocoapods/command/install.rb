@@ -3,6 +3,7 @@ module Pod
     class Install < Command
       include RepoUpdate
       include ProjectDirectory
+      include Timings
 
       self.summary = 'Install project dependencies according to versions from a Podfile.lock'
 
@@ -49,7 +50,7 @@ module Pod
         installer.update = false
         installer.deployment = @deployment
         installer.clean_install = @clean_install
-        installer.install!
+        with_timings { installer.install! }
       end
     end
   end
@@ -39,6 +39,7 @@ module Pod
             ['--analyze', 'Validate with the Xcode Static Analysis tool'],
             ['--configuration=CONFIGURATION', 'Build using the given configuration (defaults to Release)'],
             ['--validation-dir', 'The directory to use for validation. If none is specified a temporary directory will be used.'],
+            ['--jobs=N', 'The number of podspecs validated concurrently, each in its own process. Defaults to 1'],
           ].concat(super)
         end
 
@@ -65,16 +66,18 @@ module Pod
           @podspecs_paths      = argv.arguments!
           @configuration       = argv.option('configuration', nil)
           @validation_dir      = argv.option('validation-dir', nil)
+          @jobs                = argv.option('jobs', '1').to_i
           super
         end
 
         def validate!
           super
+          help! 'The number of jobs must be a positive integer' unless @jobs > 0
         end
 
         def run
           UI.puts
-          podspecs_to_lint.each do |podspec|
+          validators = podspecs_to_lint.each_with_index.map do |podspec, index|
             validator                = Validator.new(podspec, @source_urls, @platforms)
             validator.local          = true
             validator.quick          = @quick
@@ -95,9 +98,11 @@ module Pod
             validator.include_podspecs = @include_podspecs
             validator.external_podspecs = @external_podspecs
             validator.configuration = @configuration
-            validator.validation_dir = @validation_dir
-            validator.validate
+            validator.validation_dir = validation_dir_for(podspec, index)
+            validator
+          end
 
+          Validator.validate_concurrently(validators, @jobs) do |validator|
             unless @clean
               UI.puts "Pods workspace available at `#{validator.validation_dir}/App.xcworkspace` for inspection."
               UI.puts
@@ -105,7 +110,7 @@ module Pod
             if validator.validated?
               UI.puts "#{validator.spec.name} passed validation.".green
             else
-              spec_name = podspec
+              spec_name = validator.file
               spec_name = validator.spec.name if validator.spec
               message = "#{spec_name} did not pass validation, due to #{validator.failure_reason}."
 
@@ -124,6 +129,17 @@ module Pod
 
         # !@group Private helpers
 
+        # @return [String, Nil] The validation directory of the given podspec,
+        #         which is a subdirectory of the requested one when several
+        #         podspecs are validated concurrently. The subdirectory is
+        #         prefixed with the index of the podspec, since podspecs of
+        #         different directories may have the same name.
+        #
+        def validation_dir_for(podspec, index)
+          return @validation_dir unless @validation_dir && @jobs > 1
+          File.join(@validation_dir, "#{index}-#{File.basename(podspec.to_s)}")
+        end
+
         # @return [Pathname] The path of the podspec found in the current
         #         working directory.
         #
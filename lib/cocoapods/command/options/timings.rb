@@ -0,0 +1,60 @@
+module Pod
+  class Command
+    module Options
+      # Provides support for commands to write a trace of the time spent in
+      # each phase of the installation.
+      #
+      module Timings
+        module Options
+          def options
+            [
+              ['--timings[=PATH]', 'Write a trace of the time spent in each phase of the installation, in the ' \
+                'Chrome trace event format, to PATH or to `Pods/timings.json`. Can also be set with the ' \
+                '`COCOAPODS_TIMINGS` environment variable'],
+            ].concat(super)
+          end
+        end
+
+        def self.included(base)
+          base.extend(Options)
+        end
+
+        def initialize(argv)
+          @timings_path = argv.option('timings', ENV['COCOAPODS_TIMINGS'])
+          @timings_path = nil if @timings_path && @timings_path.empty?
+          @timings = argv.flag?('timings', !@timings_path.nil?)
+          super
+        end
+
+        # @return [Pathname] The path of the trace of the timings.
+        #
+        def timings_path
+          if @timings_path
+            Pathname(@timings_path).expand_path
+          else
+            config.sandbox_root + 'timings.json'
+          end
+        end
+
+        # Runs the given block, recording the time spent in each section of the
+        # user interface and writing it to the path of the trace if timings have
+        # been requested.
+        #
+        # @return [Object] The value returned by the block.
+        #
+        def with_timings
+          return yield unless @timings
+          previous_timings = UI.timings
+          UI.timings = timings = UI::Timings.new
+          begin
+            timings.measure(self.class.full_command, 'command') { yield }
+          ensure
+            UI.timings = previous_timings
+            timings.write(timings_path)
+            UI.message "- Writing timings to #{UI.path(timings_path)}"
+          end
+        end
+      end
+    end
+  end
+end
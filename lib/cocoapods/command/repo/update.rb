@@ -13,14 +13,26 @@ module Pod
           CLAide::Argument.new('NAME', false),
         ]
 
+        def self.options
+          [
+            ['--jobs=N', 'The number of spec repos updated concurrently. Defaults to 1'],
+          ].concat(super)
+        end
+
         def initialize(argv)
           @name = argv.shift_argument
+          @jobs = argv.option('jobs', '1').to_i
+          super
+        end
+
+        def validate!
           super
+          help! 'The number of jobs must be a positive integer' unless @jobs > 0
         end
 
         def run
           show_output = !config.silent?
-          config.sources_manager.update(@name, show_output)
+          config.sources_manager.update(@name, show_output, :jobs => @jobs)
           exclude_repos_dir_from_backup
         end
 
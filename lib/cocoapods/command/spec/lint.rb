@@ -38,6 +38,7 @@ module Pod
             ['--analyze', 'Validate with the Xcode Static Analysis tool'],
             ['--configuration=CONFIGURATION', 'Build using the given configuration (defaults to Release)'],
             ['--validation-dir', 'The directory to use for validation. If none is specified a temporary directory will be used.'],
+            ['--jobs=N', 'The number of podspecs validated concurrently, each in its own process. Defaults to 1'],
           ].concat(super)
         end
 
@@ -62,13 +63,19 @@ module Pod
           @podspecs_paths  = argv.arguments!
           @configuration   = argv.option('configuration', nil)
           @validation_dir = argv.option('validation-dir', nil)
+          @jobs           = argv.option('jobs', '1').to_i
           super
         end
 
+        def validate!
+          super
+          help! 'The number of jobs must be a positive integer' unless @jobs > 0
+        end
+
         def run
           UI.puts
           failure_reasons = []
-          podspecs_to_lint.each do |podspec|
+          validators = podspecs_to_lint.each_with_index.map do |podspec, index|
             validator                = Validator.new(podspec, @source_urls, @platforms)
             validator.quick          = @quick
             validator.no_clean       = !@clean
@@ -86,8 +93,11 @@ module Pod
             validator.test_specs = @test_specs
             validator.analyze = @analyze
             validator.configuration = @configuration
-            validator.validation_dir = @validation_dir
-            validator.validate
+            validator.validation_dir = validation_dir_for(podspec, index)
+            validator
+          end
+
+          Validator.validate_concurrently(validators, @jobs) do |validator|
             failure_reasons << validator.failure_reason
 
             unless @clean
@@ -115,6 +125,17 @@ module Pod
 
         private
 
+        # @return [String, Nil] The validation directory of the given podspec,
+        #         which is a subdirectory of the requested one when several
+        #         podspecs are validated concurrently. The subdirectory is
+        #         prefixed with the index of the podspec, since podspecs of
+        #         different directories may have the same name.
+        #
+        def validation_dir_for(podspec, index)
+          return @validation_dir unless @validation_dir && @jobs > 1
+          File.join(@validation_dir, "#{index}-#{File.basename(podspec.to_s)}")
+        end
+
         def podspecs_to_lint
           @podspecs_to_lint ||= begin
             files = []
@@ -3,6 +3,7 @@ module Pod
     class Update < Command
       include RepoUpdate
       include ProjectDirectory
+      include Timings
 
       self.summary = 'Update outdated project dependencies and create new ' \
         'Podfile.lock'
@@ -60,7 +61,7 @@ module Pod
           UI.puts 'Update all pods'.yellow
           installer.update = true
         end
-        installer.install!
+        with_timings { installer.install! }
       end
 
       private
@@ -17,6 +17,9 @@ module Pod
       :verbose             => false,
       :silent              => false,
       :skip_download_cache => !ENV['COCOAPODS_SKIP_CACHE'].nil?,
+      :deduplicate_download_cache => !ENV['COCOAPODS_DEDUPLICATE_CACHE'].nil?,
+      :pod_materialization => (ENV['COCOAPODS_POD_MATERIALIZATION'] || :copy).to_sym,
+      :cache_max_size      => ENV['COCOAPODS_CACHE_MAX_SIZE'],
 
       :new_version_message => ENV['COCOAPODS_SKIP_UPDATE_MESSAGE'].nil?,
 
@@ -80,6 +83,22 @@ module Pod
     attr_accessor :skip_download_cache
     alias_method :skip_download_cache?, :skip_download_cache
 
+    # @return [Boolean] Whether the files of the Pods stored in the download
+    #         cache should be deduplicated in a content-addressed store.
+    #
+    attr_accessor :deduplicate_download_cache
+    alias_method :deduplicate_download_cache?, :deduplicate_download_cache
+
+    # @return [Symbol] How the Pods are copied from the download cache to the
+    #         sandbox. Either `:copy`, `:clone` to use copy-on-write clones
+    #         where the file system supports them, or `:link` to use hard
+    #         links, in which case the files of the sandbox must not be
+    #         edited since they are shared with the cache. The source files
+    #         locked by the installer are copied before their permissions
+    #         are changed.
+    #
+    attr_accessor :pod_materialization
+
     public
 
     #-------------------------------------------------------------------------#
@@ -91,6 +110,13 @@ module Pod
     #
     attr_accessor :cache_root
 
+    # @return [String, Integer, Nil] The maximum size of the download cache,
+    #         either in bytes or with a `K`, `M` or `G` suffix. The least
+    #         recently used Pods are evicted from the cache once it grows
+    #         larger.
+    #
+    attr_accessor :cache_max_size
+
     def cache_root
       @cache_root.mkpath unless @cache_root.exist?
       @cache_root
@@ -261,6 +287,13 @@ module Pod
       cache_root + 'search_index.json'
     end
 
+    # @return [Pathname] The directory of the segmented search index, which is
+    #         updated incrementally when the spec repos change.
+    #
+    def search_index_dir
+      cache_root + 'search_index'
+    end
+
     private
 
     #-------------------------------------------------------------------------#
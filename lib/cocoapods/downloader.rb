@@ -1,13 +1,17 @@
 require 'cocoapods-downloader'
 require 'claide/informative_error'
 require 'fileutils'
+require 'find'
 require 'tmpdir'
 
 module Pod
   module Downloader
+    require 'cocoapods/downloader/blob_store'
     require 'cocoapods/downloader/cache'
+    require 'cocoapods/downloader/cache_index'
     require 'cocoapods/downloader/request'
     require 'cocoapods/downloader/response'
+    require 'cocoapods/downloader/streaming_extractor'
 
     # Downloads a pod from the given `request` to the given `target` location.
     #
@@ -38,7 +42,9 @@ module Pod
 
       if can_cache
         raise ArgumentError, 'Must provide a `cache_path` when caching.' unless cache_path
-        cache = Cache.new(cache_path)
+        cache = Cache.new(cache_path,
+                          :deduplicate => Config.instance.deduplicate_download_cache?,
+                          :max_size => Cache.parse_size(Config.instance.cache_max_size))
         result = cache.download_pod(request)
       else
         raise ArgumentError, 'Must provide a `target` when caching is disabled.' unless target
@@ -50,9 +56,16 @@ module Pod
 
       if target && result.location && target != result.location
         UI.message "Copying #{request.name} from `#{result.location}` to #{UI.path target}", '> ' do
-          Cache.read_lock(result.location) do
-            FileUtils.rm_rf target
-            FileUtils.cp_r(result.location, target)
+          retried = false
+          begin
+            materialize(result.location, target)
+          rescue Errno::ENOENT
+            # The cached Pod has been removed while it was copied, along with
+            # its specification, so it is downloaded again.
+            raise if !can_cache || result.location.exist? || retried
+            retried = true
+            result = cache.download_pod(request)
+            retry
           end
         end
       end
@@ -117,6 +130,66 @@ module Pod
       end
     end
 
+    # Copies the cached Pod at `source` to `target`, cloning or linking its
+    # files instead if the configuration asks for it and the file system
+    # supports it.
+    #
+    # @param  [Pathname] source
+    #
+    # @param  [Pathname] target
+    #
+    # @param  [Symbol] mode
+    #         @see Config#pod_materialization
+    #
+    # @return [void]
+    #
+    def self.materialize(source, target, mode = Config.instance.pod_materialization)
+      FileUtils.rm_rf(target)
+      case mode.to_sym
+      when :clone
+        return if clone_directory(source, target)
+      when :link
+        return if link_directory(source, target)
+      end
+      FileUtils.cp_r(source, target)
+    end
+
+    # Clones the `source` directory to `target` with copy-on-write clones of
+    # its files.
+    #
+    # @return [Boolean] Whether the directory has been cloned.
+    #
+    def self.clone_directory(source, target)
+      flags = RUBY_PLATFORM.include?('darwin') ? %w(-c -R) : %w(-R --reflink=auto)
+      Executable.execute_command('cp', [*flags, source.to_s, target.to_s], true)
+      true
+    rescue Informative
+      FileUtils.rm_rf(target)
+      false
+    end
+
+    # Recreates the `source` directory at `target` with hard links to its
+    # files.
+    #
+    # @return [Boolean] Whether the directory has been linked.
+    #
+    def self.link_directory(source, target)
+      Find.find(source.to_s) do |path|
+        destination = target.to_s + path[source.to_s.length..-1]
+        if File.symlink?(path)
+          File.symlink(File.readlink(path), destination)
+        elsif File.directory?(path)
+          Dir.mkdir(destination)
+        else
+          File.link(path, destination)
+        end
+      end
+      true
+    rescue SystemCallError
+      FileUtils.rm_rf(target)
+      false
+    end
+
     # Return a new request after preprocessing by the downloader
     #
     # @param  [Request] request
@@ -0,0 +1,117 @@
+require 'digest'
+require 'find'
+require 'fileutils'
+require 'json'
+
+module Pod
+  module Downloader
+    # A content-addressed store of the files of the cached Pods.
+    #
+    # The files of a cached Pod are replaced by hard links to the blob of
+    # their contents, so that a file shared by several cached Pods, or by
+    # several versions of a Pod, is only stored once. The contents of each
+    # cached Pod are recorded in a manifest which maps the relative path of
+    # every file to its blob.
+    #
+    class BlobStore
+      # @return [Pathname] The root directory of the blobs.
+      #
+      attr_reader :root
+
+      # Initialize a new instance
+      #
+      # @param  [Pathname] root @see #root
+      #
+      def initialize(root)
+        @root = root
+      end
+
+      # @param  [String] address
+      #         The address of a blob.
+      #
+      # @return [Pathname] The path of the blob with the given address.
+      #
+      def blob_path(address)
+        root + address[0, 2] + address
+      end
+
+      # Replaces the files of the given directory by links to their blobs,
+      # adding the blobs which are missing from the store, and writes the
+      # manifest of the directory.
+      #
+      # @param  [Pathname] directory
+      #         The directory to deduplicate.
+      #
+      # @param  [Pathname] manifest_path
+      #         The path of the manifest of the directory.
+      #
+      # @return [Boolean] Whether the directory has been deduplicated. It is
+      #         left untouched if the file system does not support hard links.
+      #
+      def deduplicate!(directory, manifest_path)
+        manifest = {}
+        Find.find(directory.to_s) do |path|
+          next unless File.file?(path) && !File.symlink?(path)
+          address = address_of(path)
+          return false unless store(path, address)
+          manifest[path[directory.to_s.length + 1..-1]] = address
+        end
+        manifest_path.dirname.mkpath
+        manifest_path.open('w') { |f| f.write(JSON.pretty_generate(manifest)) }
+        true
+      end
+
+      # Removes the blobs which are not linked from any cached Pod.
+      #
+      # @return [Integer] The number of bytes freed.
+      #
+      def remove_unused_blobs!
+        return 0 unless root.directory?
+        Pathname.glob(root + '*/*').reduce(0) do |freed, blob|
+          stat = blob.lstat
+          next freed unless stat.file? && stat.nlink == 1
+          blob.delete
+          freed + stat.size
+        end
+      end
+
+      private
+
+      # @return [String] The address of the blob of the file at the given
+      #         path, which depends on its contents and its permissions since
+      #         they are shared by all the links to the blob.
+      #
+      def address_of(path)
+        "#{Digest::SHA256.file(path).hexdigest}-#{format('%o', File.stat(path).mode & 0o7777)}"
+      end
+
+      # Links the file at the given path to the blob with the given address,
+      # adding it to the store if it is missing.
+      #
+      # @return [Boolean] Whether the file is linked to its blob.
+      #
+      def store(path, address)
+        blob = blob_path(address)
+        blob.dirname.mkpath
+        begin
+          File.link(path, blob)
+          return true
+        rescue Errno::EEXIST
+          return true if File.identical?(path, blob)
+        rescue Errno::EPERM, Errno::ENOTSUP, Errno::EXDEV
+          return false
+        end
+
+        temp_path = "#{path}.#{Process.pid}.link"
+        begin
+          File.link(blob, temp_path)
+        rescue Errno::ENOENT
+          # The blob has been removed as unused in the meantime.
+          return store(path, address)
+        end
+        File.rename(temp_path, path)
+        true
+      end
+    end
+  end
+end
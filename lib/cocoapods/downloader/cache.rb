@@ -6,22 +6,115 @@ module Pod
     # The class responsible for managing Pod downloads, transparently caching
     # them in a cache directory.
     #
+    # Cached Pods are prepared in a staging directory and published by
+    # renaming it into place, and their specification is written last, once
+    # the Pod is complete. Looking up a cached Pod therefore requires no lock:
+    # a Pod whose specification exists is complete, and is not modified until
+    # it is removed from the cache. Copying it out of the cache requires no
+    # lock either, since a Pod is removed by first moving its directory out
+    # of the way with {#discard}: a copy is then either complete or fails to
+    # find its source, in which case it is retried.
+    #
     class Cache
       # @return [Pathname] The root directory where this cache store its
       #         downloads.
       #
       attr_reader :root
 
+      # @return [Boolean] Whether the files of the cached Pods are deduplicated
+      #         in the {#blob_store}.
+      #
+      attr_reader :deduplicate
+      alias_method :deduplicate?, :deduplicate
+
+      # @return [Integer, Nil] The size in bytes above which the least recently
+      #         used Pods are evicted after a download, if any.
+      #
+      attr_reader :max_size
+
+      # @return [Integer] The number of seconds during which a Pod which has
+      #         just been used can not be evicted, since another process may
+      #         still be copying it out of the cache, and would have to
+      #         download it again.
+      #
+      EVICTION_GRACE_PERIOD = 10 * 60
+
+      # @return [Hash{String => Integer}] The multipliers of the suffixes
+      #         accepted by {Cache.parse_size}.
+      #
+      SIZE_UNITS = { '' => 1, 'K' => 1024, 'M' => 1024**2, 'G' => 1024**3, 'T' => 1024**4 }.freeze
+
       # Initialize a new instance
       #
       # @param  [Pathname,String] root
       #         see {#root}
       #
-      def initialize(root)
+      # @param  [Boolean] deduplicate
+      #         see {#deduplicate}
+      #
+      # @param  [Integer, Nil] max_size
+      #         see {#max_size}
+      #
+      def initialize(root, deduplicate: false, max_size: nil)
         @root = Pathname(root)
+        @deduplicate = deduplicate
+        @max_size = max_size
         ensure_matching_version
       end
 
+      # Parses a size such as `500M` or `10G`.
+      #
+      # @param  [String, Integer, Nil] size
+      #         the size, either in bytes or with a `K`, `M`, `G` or `T`
+      #         suffix.
+      #
+      # @return [Integer, Nil] The size in bytes.
+      #
+      def self.parse_size(size)
+        return if size.nil? || size.to_s.strip.empty?
+        match = size.to_s.strip.upcase.match(/\A(\d+(?:\.\d+)?)\s*([KMGT]?)I?B?\z/)
+        raise Informative, "Invalid cache size `#{size}`, expected a number of bytes optionally followed by K, M, G or T." unless match
+        (Float(match[1]) * SIZE_UNITS[match[2]]).to_i
+      end
+
+      # @return [BlobStore] The content-addressed store of the files of the
+      #         cached Pods.
+      #
+      def blob_store
+        @blob_store ||= BlobStore.new(root + 'Blobs')
+      end
+
+      # @param  [Pathname] slug
+      #         the path of a cached Pod.
+      #
+      # @return [Pathname] The path of the manifest of the files of the cached
+      #         Pod, written when it is deduplicated.
+      #
+      def manifest_path(slug)
+        root + 'Manifests' + "#{slug.relative_path_from(root)}.json"
+      end
+
+      # Removes the manifest of the given cached Pod.
+      #
+      # @param  [Pathname] slug
+      #         the path of a cached Pod.
+      #
+      # @return [void]
+      #
+      def remove_manifest(slug)
+        FileUtils.rm_f(manifest_path(slug))
+      end
+
+      # Removes the blobs which are not used by any cached Pod anymore.
+      #
+      # @return [Integer] The number of bytes freed.
+      #
+      def remove_unused_blobs
+        Cache.write_lock(blob_store.root) do
+          blob_store.remove_unused_blobs!
+        end
+      end
+
       # Downloads the Pod from the given `request`
       #
       # @param  [Request] request
@@ -30,7 +123,11 @@ module Pod
       # @return [Response] the response from downloading `request`
       #
       def download_pod(request)
-        cached_pod(request) || uncached_pod(request)
+        cached_pod(request) || begin
+          response = uncached_pod(request)
+          evict(max_size) if max_size
+          response
+        end
       rescue Informative
         raise
       rescue
@@ -38,37 +135,123 @@ module Pod
         raise
       end
 
+      # @return [CacheIndex] The index of the cached Pods.
+      #
+      def index
+        @index ||= CacheIndex.new(root)
+      end
+
       # @return [Hash<String, Hash<Symbol, String>>]
       #         A hash whose keys are the pod name
       #         And values are a hash with the following keys:
-      #         :spec_file : path to the spec file
-      #         :name      : name of the pod
-      #         :version   : pod version
-      #         :release   : boolean to tell if that's a release pod
-      #         :slug      : the slug path where the pod cache is located
+      #         :spec_file   : path to the spec file
+      #         :name        : name of the pod
+      #         :version     : pod version
+      #         :release     : boolean to tell if that's a release pod
+      #         :slug        : the slug path where the pod cache is located
+      #         :size        : the size in bytes of the cached pod
+      #         :accessed_at : the time the cached pod was last used at
+      #
+      # @note   The descriptors are read from the {#index}, which is built
+      #         from the cached specifications if it does not exist yet.
       #
       def cache_descriptors_per_pod
-        specs_dir = root + 'Specs'
-        release_specs_dir = specs_dir + 'Release'
-        return {} unless specs_dir.exist?
-
-        spec_paths = specs_dir.find.select { |f| f.fnmatch('*.podspec.json') }
-        spec_paths.reduce({}) do |hash, spec_path|
-          spec = Specification.from_file(spec_path)
-          hash[spec.name] ||= []
-          is_release = spec_path.to_s.start_with?(release_specs_dir.to_s)
-          request = Downloader::Request.new(:spec => spec, :released => is_release)
-          hash[spec.name] << {
-            :spec_file => spec_path,
-            :name => spec.name,
-            :version => spec.version,
-            :release => is_release,
-            :slug => root + request.slug,
+        rebuild_index unless index.exist?
+        entries = index.entries.values.sort_by { |entry| entry['spec_file'] }
+        entries.each_with_object({}) do |entry, hash|
+          hash[entry['name']] ||= []
+          hash[entry['name']] << {
+            :spec_file => root + entry['spec_file'],
+            :name => entry['name'],
+            :version => Version.new(entry['version']),
+            :release => entry['release'],
+            :slug => root + entry['slug'],
+            :size => entry['size'],
+            :accessed_at => Time.at(entry['accessed_at']),
           }
-          hash
         end
       end
 
+      # Rebuilds the {#index} from the cached specifications.
+      #
+      # @return [void]
+      #
+      def rebuild_index
+        specs_dir = root + 'Specs'
+        spec_paths = specs_dir.exist? ? specs_dir.find.select { |f| f.fnmatch('*.podspec.json') } : []
+        entries = spec_paths.map do |spec_path|
+          index_entry(spec_path, Specification.from_file(spec_path), spec_path.mtime)
+        end
+        index.write(entries)
+      end
+
+      # Evicts the least recently used Pods until the cache is no larger than
+      # the given size. The Pods used during the {EVICTION_GRACE_PERIOD} are
+      # never evicted, and each Pod is removed under its exclusive lock, so
+      # that it is not removed while it is published.
+      #
+      # @note   The sizes of the Pods are the ones recorded in the {#index}, so
+      #         the files shared through the {#blob_store} are counted once
+      #         for every Pod using them.
+      #
+      # @param  [Integer] size
+      #         the size in bytes the cache should not grow larger than.
+      #
+      # @return [Array<Pathname>] The paths of the evicted Pods.
+      #
+      def evict(size)
+        Cache.write_lock(root + 'Eviction') do
+          rebuild_index unless index.exist?
+          entries = index.entries.values
+          total_size = entries.reduce(0) { |sum, entry| sum + entry['size'].to_i }
+          evicted = []
+          recent = Time.now.to_i - EVICTION_GRACE_PERIOD
+          entries.sort_by { |entry| entry['accessed_at'].to_i }.each do |entry|
+            break if total_size <= size || entry['accessed_at'].to_i > recent
+            slug = root + entry['slug']
+            Cache.write_lock(slug) do
+              FileUtils.rm_f(root + entry['spec_file'])
+              discard(slug)
+              remove_manifest(slug)
+              index.remove(entry['slug'])
+            end
+            total_size -= entry['size'].to_i
+            evicted << slug
+          end
+          remove_unused_blobs if deduplicate? && !evicted.empty?
+          evicted
+        end
+      end
+
+      # Removes the given cached Pod from the {#index}.
+      #
+      # @param  [Pathname] slug
+      #         the path of the cached Pod.
+      #
+      # @return [void]
+      #
+      def remove_from_index(slug)
+        index.remove(slug.relative_path_from(root).to_s) if index.exist?
+      end
+
+      # Removes the given directory of the cache, after moving it atomically
+      # out of the way so that the processes copying it out of the cache do
+      # not copy it partially without noticing it.
+      #
+      # @param  [Pathname] directory
+      #         the directory to remove.
+      #
+      # @return [void]
+      #
+      def discard(directory)
+        return unless directory.exist?
+        trash = root + '.Trash'
+        trash.mkpath
+        discarded = Pathname(Dir.mktmpdir(directory.basename.to_s, trash))
+        directory.rename(discarded + directory.basename)
+        FileUtils.rm_rf(discarded)
+      end
+
       # Convenience method for acquiring a shared lock to safely read from the
       # cache. See `Cache.lock` for more details.
       #
@@ -207,11 +390,14 @@ module Pod
       #         was found in the download cache.
       #
       def cached_pod(request)
-        cached_spec = cached_spec(request)
         path = path_for_pod(request)
+        return unless path_for_spec(request).file? && path.directory?
 
-        return unless cached_spec && path.directory?
-        spec = request.spec || cached_spec
+        # The cached specification of a released Pod is the one of the
+        # request, so it does not need to be parsed.
+        spec = request.spec || cached_spec(request)
+        return unless spec
+        index.touch(request.slug) if index.exist?
         Response.new(path, spec, request.params)
       end
 
@@ -235,14 +421,23 @@ module Pod
       #         was not found in the download cache.
       #
       def uncached_pod(request)
+        if streamable?(request)
+          begin
+            return streamed_pod(request)
+          rescue StreamingExtractor::UnsupportedEntryError => e
+            UI.message "#{e.message}, extracting it with `tar` instead"
+          end
+        end
+
         in_tmpdir do |target|
           result, podspecs = download(request, target)
           result.location = nil
 
           podspecs.each do |name, spec|
             destination = path_for_pod(request, :name => name, :params => result.checkout_options)
-            copy_and_clean(target, destination, spec)
-            write_spec(spec, path_for_spec(request, :name => name, :params => result.checkout_options))
+            spec_path = path_for_spec(request, :name => name, :params => result.checkout_options)
+            copy_and_clean(target, destination, spec, spec_path)
+            write_spec(spec, spec_path)
             if request.name == name
               result.location = destination
             end
@@ -256,6 +451,41 @@ module Pod
         Downloader.download_request(request, target)
       end
 
+      # @param  [Request] request
+      #         the request to be downloaded.
+      #
+      # @return [Boolean] Whether the given request is for a released Pod
+      #         whose source is an archive which can be extracted while it is
+      #         downloaded.
+      #
+      def streamable?(request)
+        request.released_pod? && StreamingExtractor.supports?(request.params)
+      end
+
+      # Extracts the archive of the given `request` straight into the cache
+      # while it is downloaded.
+      #
+      # @param  [Request] request
+      #         the request to be downloaded.
+      #
+      # @return [Response] The download response for the given `request`.
+      #
+      def streamed_pod(request)
+        spec = request.spec
+        destination = path_for_pod(request)
+        destination.parent.mkpath
+        staging = staging_path(destination)
+        FileUtils.rm_rf(staging)
+        StreamingExtractor.new(request.params).extract!(staging)
+        prepare_and_clean(staging, spec)
+        deduplicate_contents(staging, destination) if deduplicate?
+        publish(staging, destination, path_for_spec(request))
+        write_spec(spec, path_for_spec(request))
+        Response.new(destination, spec, request.params)
+      ensure
+        FileUtils.rm_rf(staging) if staging
+      end
+
       # Performs the given block inside a temporary directory,
       # which is removed at the end of the block's scope.
       #
@@ -277,15 +507,75 @@ module Pod
       #
       # @param  [Specification] spec
       #
+      # @param  [Pathname] spec_path
+      #         the path of the cached specification of the Pod.
+      #
       # @return [Void]
       #
-      def copy_and_clean(source, destination, spec)
-        specs_by_platform = group_subspecs_by_platform(spec)
+      def copy_and_clean(source, destination, spec, spec_path)
         destination.parent.mkpath
+        staging = staging_path(destination)
+        FileUtils.rm_rf(staging)
+        rsync_contents(source, staging)
+        prepare_and_clean(staging, spec)
+        deduplicate_contents(staging, destination) if deduplicate?
+        publish(staging, destination, spec_path)
+      ensure
+        FileUtils.rm_rf(staging) if staging
+      end
+
+      # Prepares the Pod at `directory` and cleans it of any files unused by
+      # `spec`.
+      #
+      # @param  [Pathname] directory
+      #
+      # @param  [Specification] spec
+      #
+      # @return [Void]
+      #
+      def prepare_and_clean(directory, spec)
+        specs_by_platform = group_subspecs_by_platform(spec)
+        Pod::Installer::PodSourcePreparer.new(spec, directory).prepare!
+        Sandbox::PodDirCleaner.new(directory, specs_by_platform).clean!
+      end
+
+      # @param  [Pathname] destination
+      #         the path of a cached Pod.
+      #
+      # @return [Pathname] The directory the Pod is prepared in before it is
+      #         published at `destination`.
+      #
+      def staging_path(destination)
+        destination.dirname + ".#{destination.basename}.#{Process.pid}.tmp"
+      end
+
+      # Publishes the Pod prepared in `staging` at `destination`, replacing
+      # the previous version of the cached Pod if it is incomplete.
+      #
+      # A complete Pod, published by another process in the meantime, is
+      # kept and the staging directory is discarded, since the Pod is
+      # identical and may already have been looked up by other processes.
+      #
+      # @param  [Pathname] staging
+      #
+      # @param  [Pathname] destination
+      #
+      # @param  [Pathname] spec_path
+      #         the path of the specification marking the Pod as complete.
+      #
+      # @return [Void]
+      #
+      def publish(staging, destination, spec_path)
         Cache.write_lock(destination) do
-          rsync_contents(source, destination)
-          Pod::Installer::PodSourcePreparer.new(spec, destination).prepare!
-          Sandbox::PodDirCleaner.new(destination, specs_by_platform).clean!
+          next if spec_path.file? && destination.directory?
+          discard(destination)
+          staging.rename(destination)
+        end
+      end
+
+      def deduplicate_contents(directory, destination)
+        Cache.read_lock(blob_store.root) do
+          blob_store.deduplicate!(directory, manifest_path(destination))
         end
       end
 
@@ -304,7 +594,9 @@ module Pod
         specs_by_platform
       end
 
-      # Writes the given `spec` to the given `path`.
+      # Writes the given `spec` to the given `path`, and records the cached Pod
+      # in the index. The specification is written atomically since it marks
+      # the cached Pod as complete.
       #
       # @param  [Specification] spec
       #         the specification to be written.
@@ -317,9 +609,56 @@ module Pod
       def write_spec(spec, path)
         path.dirname.mkpath
         Cache.write_lock(path) do
-          path.open('w') { |f| f.write spec.to_pretty_json }
+          temp_path = "#{path}.#{Process.pid}.tmp"
+          File.open(temp_path, 'w') { |f| f.write spec.to_pretty_json }
+          File.rename(temp_path, path)
+          if index.exist?
+            index.add(index_entry(path, spec))
+          else
+            rebuild_index
+          end
         end
       end
+
+      # @param  [Pathname] spec_path
+      #         the path of a cached specification.
+      #
+      # @param  [Specification] spec
+      #         the cached specification.
+      #
+      # @param  [Time] accessed_at
+      #         the time the cached Pod was last used at.
+      #
+      # @return [Hash] The record of the cached Pod in the index.
+      #
+      # @note   The slug is the path of the specification relative to the
+      #         `Specs` directory, since it can not be computed again from
+      #         the cached specification: the slugs of the external Pods are
+      #         derived from the parameters of their request, and the ones of
+      #         the released Pods from the checksum of their original
+      #         specification.
+      #
+      def index_entry(spec_path, spec, accessed_at = Time.now)
+        slug = spec_path.relative_path_from(root + 'Specs').to_s.chomp('.podspec.json')
+        is_release = slug.start_with?('Release/')
+        {
+          'slug' => slug,
+          'spec_file' => spec_path.relative_path_from(root).to_s,
+          'name' => spec.name,
+          'version' => spec.version.to_s,
+          'release' => is_release,
+          'size' => directory_size(root + slug),
+          'accessed_at' => accessed_at.to_i,
+        }
+      end
+
+      # @return [Integer] The size in bytes of the files of the given
+      #         directory.
+      #
+      def directory_size(directory)
+        return 0 unless directory.directory?
+        directory.find.reduce(0) { |size, path| path.file? && !path.symlink? ? size + path.size : size }
+      end
     end
   end
 end
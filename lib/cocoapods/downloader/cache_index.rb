@@ -0,0 +1,148 @@
+require 'json'
+
+module Pod
+  module Downloader
+    # An append-only index of the Pods stored in a download {Cache}, so that
+    # the cache can be listed without parsing every cached specification.
+    #
+    # Each line of the index is a JSON record keyed by the slug of a cached
+    # Pod, relative to the root of the cache. A record either describes a
+    # cached Pod, updates the time it has been last accessed at, or marks it
+    # as removed. The latest records win when the index is read.
+    #
+    class CacheIndex
+      # @return [Integer] The size in bytes above which the index is compacted
+      #         when a record is appended to it.
+      #
+      COMPACTION_THRESHOLD = 1024 * 1024
+
+      # @return [Pathname] The root directory of the cache.
+      #
+      attr_reader :root
+
+      # Initialize a new instance
+      #
+      # @param  [Pathname] root @see #root
+      #
+      def initialize(root)
+        @root = root
+      end
+
+      # @return [Pathname] The path of the index file.
+      #
+      def path
+        root + 'INDEX'
+      end
+
+      # @return [Boolean] Whether the index file exists.
+      #
+      def exist?
+        path.file?
+      end
+
+      # @return [Hash{String => Hash}] The records of the cached Pods keyed by
+      #         their slug.
+      #
+      def entries
+        Cache.read_lock(path) { read_entries }
+      end
+
+      # Records a cached Pod.
+      #
+      # @param  [Hash] entry
+      #         The record of the Pod, with the `slug`, `spec_file`, `name`,
+      #         `version`, `release`, `size` and `accessed_at` keys.
+      #
+      # @return [void]
+      #
+      def add(entry)
+        append(entry)
+      end
+
+      # Records that the cached Pod with the given slug has been accessed.
+      #
+      # @param  [String] slug
+      #         The slug of the Pod, relative to the root of the cache.
+      #
+      # @param  [Time] time
+      #         The time the Pod has been accessed at.
+      #
+      # @return [void]
+      #
+      def touch(slug, time = Time.now)
+        record = { 'slug' => slug, 'accessed_at' => time.to_i }
+        return append(record) if path.file? && path.size > COMPACTION_THRESHOLD
+        # Cached Pods are looked up without locking the cache. Appending a
+        # single line is atomic, and a record lost to a concurrent compaction
+        # only makes the Pod look older than it is.
+        path.open('a') { |f| f.puts(record.to_json) }
+      end
+
+      # Records that the cached Pod with the given slug has been removed.
+      #
+      # @param  [String] slug
+      #         The slug of the Pod, relative to the root of the cache.
+      #
+      # @return [void]
+      #
+      def remove(slug)
+        append('slug' => slug, 'removed' => true)
+      end
+
+      # Replaces the index with the given records.
+      #
+      # @param  [Array<Hash>] entries
+      #         The records of all the cached Pods.
+      #
+      # @return [void]
+      #
+      def write(entries)
+        Cache.write_lock(path) { write_entries(entries) }
+      end
+
+      private
+
+      def append(record)
+        Cache.write_lock(path) do
+          if path.file? && path.size > COMPACTION_THRESHOLD
+            write_entries(apply(read_entries, record).values)
+          else
+            path.open('a') { |f| f.puts(record.to_json) }
+          end
+        end
+      end
+
+      def read_entries
+        return {} unless path.file?
+        path.each_line.reduce({}) do |entries, line|
+          record = begin
+                     JSON.parse(line)
+                   rescue JSON::ParserError
+                     next entries
+                   end
+          apply(entries, record)
+        end
+      end
+
+      def apply(entries, record)
+        slug = record['slug']
+        if record['removed']
+          entries.delete(slug)
+        elsif record.key?('spec_file')
+          entries[slug] = record
+        elsif entries[slug]
+          entries[slug] = entries[slug].merge(record)
+        end
+        entries
+      end
+
+      def write_entries(entries)
+        temp_path = "#{path}.#{Process.pid}.tmp"
+        File.open(temp_path, 'w') do |f|
+          entries.each { |entry| f.puts(entry.to_json) }
+        end
+        File.rename(temp_path, path)
+      end
+    end
+  end
+end
@@ -0,0 +1,305 @@
+require 'digest'
+require 'fileutils'
+require 'rubygems/package'
+require 'uri'
+require 'zlib'
+
+module Pod
+  module Downloader
+    # Extracts the tarball of an HTTP source while it is being downloaded, so
+    # that its files are written once, directly to their final location,
+    # instead of being downloaded to a file, extracted to a temporary
+    # directory and then copied.
+    #
+    # Like the HTTP downloader, the contents of the archive are moved up when
+    # the archive only contains a directory, unless the `:flatten` option is
+    # `false`, and the `:sha1` and `:sha256` options are verified against the
+    # archive.
+    #
+    class StreamingExtractor
+      # @return [Array<Symbol>] The archive types which can be extracted while
+      #         they are downloaded.
+      #
+      TYPES = [:tar, :tgz].freeze
+
+      # @return [Integer] The number of bytes read from the download at once.
+      #
+      CHUNK_SIZE = 64 * 1024
+
+      # @return [Array<String>] The types of the entries which are regular
+      #         files, including the ones of the archives predating ustar.
+      #
+      REGULAR_FILE_TYPES = ['0', '7', "\0", ''].freeze
+
+      # Raised when the archive contains an entry which can not be extracted
+      # while it is downloaded, in which case the archive should be
+      # downloaded and extracted with `tar` instead.
+      #
+      class UnsupportedEntryError < DownloaderError; end
+
+      # @param  [Hash<Symbol,String>] params
+      #         the download options of the source.
+      #
+      # @return [Boolean] Whether the source described by the given options can
+      #         be extracted while it is downloaded.
+      #
+      def self.supports?(params)
+        !params[:http].nil? && TYPES.include?(archive_type(params))
+      end
+
+      # @param  [Hash<Symbol,String>] params
+      #         the download options of the source.
+      #
+      # @return [Symbol, Nil] The type of the archive, from the `:type` option
+      #         or else from the extension of the URL.
+      #
+      def self.archive_type(params)
+        return params[:type].to_sym if params[:type]
+        path = URI.parse(params[:http].to_s).path.to_s
+        case path
+        when /\.(tgz|tar\.gz)\z/ then :tgz
+        when /\.tar\z/ then :tar
+        end
+      rescue URI::InvalidURIError
+        nil
+      end
+
+      # @return [Hash<Symbol,String>] The download options of the source.
+      #
+      attr_reader :params
+
+      # Initialize a new instance
+      #
+      # @param  [Hash<Symbol,String>] params @see #params
+      #
+      def initialize(params)
+        @params = params
+      end
+
+      # Downloads the archive and extracts it to the given directory.
+      #
+      # @param  [Pathname] destination
+      #         the directory the archive is extracted to, which must not
+      #         exist yet.
+      #
+      # @raise  [DownloaderError] if the archive could not be downloaded, is
+      #         invalid or does not match its checksum. The destination is
+      #         removed in that case.
+      #
+      # @return [void]
+      #
+      def extract!(destination)
+        destination.mkpath
+        digests = Hash[[:sha1, :sha256].select { |key| params[key] }.map { |key| [key, Digest.const_get(key.upcase).new] }]
+        @next_names = {}
+        open_stream do |io|
+          stream = DigestingStream.new(io, digests.values)
+          archive = self.class.archive_type(params) == :tgz ? Zlib::GzipReader.new(stream) : stream
+          Gem::Package::TarReader.new(archive).each { |entry| extract_entry(entry, destination) }
+          # The checksums cover the whole archive, including its padding.
+          nil while stream.read(CHUNK_SIZE)
+        end
+        digests.each do |key, digest|
+          next if digest.hexdigest == params[key]
+          raise DownloaderError, "#{key.upcase} hash mismatch for `#{params[:http]}`: expected #{params[key]}, got #{digest.hexdigest}"
+        end
+        flatten!(destination) unless params[:flatten] == false
+      rescue Zlib::Error, Gem::Package::TarInvalidError, ArgumentError, SystemCallError => e
+        FileUtils.rm_rf(destination)
+        raise DownloaderError, "Unable to extract `#{params[:http]}`: #{e.message}"
+      rescue StandardError
+        FileUtils.rm_rf(destination)
+        raise
+      end
+
+      private
+
+      # Yields the stream of the contents of the archive, read from the file
+      # system for `file` URLs and downloaded with `curl` otherwise.
+      #
+      def open_stream
+        uri = URI.parse(params[:http].to_s)
+        if uri.scheme.nil? || uri.scheme == 'file'
+          return File.open(URI::DEFAULT_PARSER.unescape(uri.path), 'rb') { |io| yield io }
+        end
+
+        headers = Array(params[:headers]).flat_map { |header| ['-H', header] }
+        command = ['curl', '-f', '-L', '-s', '--netrc-optional', '--retry', '2', *headers, params[:http].to_s]
+        error = nil
+        result = IO.popen(command, 'rb', :err => File::NULL) do |io|
+          begin
+            yield io
+          rescue StandardError => error
+            nil
+          end
+        end
+        # curl is interrupted when the extraction fails before the end of the
+        # download, in which case the extraction error is the relevant one.
+        interrupted = $?.signaled? || $?.exitstatus == 23
+        unless $?.success? || (error && interrupted)
+          raise DownloaderError, "Unable to download `#{params[:http]}` (curl exited with #{$?.exitstatus})"
+        end
+        raise error if error
+        result
+      end
+
+      # Writes the given entry of the archive below the given directory.
+      #
+      # The GNU long name and pax extended headers are recorded and applied
+      # to the entry which follows them.
+      #
+      # @raise  [UnsupportedEntryError] if the type of the entry can not be
+      #         extracted.
+      #
+      def extract_entry(entry, destination)
+        typeflag = entry.header.typeflag
+        case typeflag
+        when 'L' then return @next_names['path'] = read_long_name(entry)
+        when 'K' then return @next_names['linkpath'] = read_long_name(entry)
+        when 'x' then return @next_names.update(pax_records(entry).select { |key, _| %w(path linkpath).include?(key) })
+        # Global headers only carry metadata, such as the commit of the
+        # archives created by `git archive`.
+        when 'g' then return
+        end
+        name = @next_names.delete('path') || entry.full_name
+        linkname = @next_names.delete('linkpath') || entry.header.linkname
+        directory = typeflag == '5' || (REGULAR_FILE_TYPES.include?(typeflag) && name.end_with?('/'))
+        unless directory || %w(1 2).include?(typeflag) || REGULAR_FILE_TYPES.include?(typeflag)
+          raise UnsupportedEntryError, "The archive `#{params[:http]}` contains an entry of unsupported type `#{typeflag}`: `#{name}`"
+        end
+
+        relative_path = name.sub(%r{\A(\./)+}, '')
+        return if relative_path.empty? || relative_path == '.'
+        path = destination + relative_path
+        unless inside?(path, destination)
+          raise DownloaderError, "The archive `#{params[:http]}` contains a file outside of its root: `#{name}`"
+        end
+        check_no_symlink_in_path!(path.dirname, destination, name)
+
+        path.dirname.mkpath
+        mode = entry.header.mode & 0o777
+        if directory
+          check_no_symlink_in_path!(path, destination, name)
+          path.mkpath
+          path.chmod(mode | 0o700)
+        elsif typeflag == '2'
+          unless !Pathname(linkname).absolute? && inside?(path.dirname + linkname, destination, true)
+            raise DownloaderError, "The archive `#{params[:http]}` contains a symbolic link outside of its root: `#{name}` -> `#{linkname}`"
+          end
+          FileUtils.rm_f(path)
+          File.symlink(linkname, path)
+        elsif typeflag == '1'
+          target = destination + linkname
+          unless inside?(target, destination)
+            raise DownloaderError, "The archive `#{params[:http]}` contains a hard link outside of its root: `#{name}` -> `#{linkname}`"
+          end
+          check_no_symlink_in_path!(target.cleanpath.dirname, destination, name)
+          FileUtils.rm_f(path)
+          File.link(target, path)
+        else
+          # Replaces rather than truncates the file, which may be a link.
+          FileUtils.rm_f(path)
+          path.open('wb') do |file|
+            while (data = entry.read(CHUNK_SIZE))
+              file.write(data)
+            end
+          end
+          path.chmod(mode)
+        end
+      end
+
+      # @return [String] The name stored in a GNU long name entry.
+      #
+      def read_long_name(entry)
+        entry.read.to_s.sub(/\0.*\z/m, '').force_encoding(Encoding::UTF_8)
+      end
+
+      # @return [Hash{String => String}] The records of a pax extended header
+      #         entry, each stored as `<length> <key>=<value>\n`.
+      #
+      def pax_records(entry)
+        data = entry.read.to_s
+        records = {}
+        until data.empty?
+          length = data[/\A\d+/].to_i
+          raise Gem::Package::TarInvalidError, 'invalid pax extended header' if length.zero? || length > data.bytesize
+          key, value = data.byteslice(0, length).chomp("\n").split(' ', 2).last.split('=', 2)
+          records[key] = value.to_s.force_encoding(Encoding::UTF_8)
+          data = data.byteslice(length, data.bytesize - length)
+        end
+        records
+      end
+
+      # @param  [Boolean] allow_root
+      #         whether the destination itself is accepted.
+      #
+      # @return [Boolean] Whether the given path is inside the destination.
+      #
+      def inside?(path, destination, allow_root = false)
+        path = path.cleanpath.to_s
+        root = destination.cleanpath.to_s
+        path.start_with?("#{root}/") || (allow_root && path == root)
+      end
+
+      # Refuses to write through a symbolic link extracted from the archive,
+      # which could otherwise redirect the entries outside of the destination.
+      #
+      # @return [void]
+      #
+      def check_no_symlink_in_path!(path, destination, name)
+        current = destination.cleanpath
+        path.cleanpath.relative_path_from(current).each_filename do |component|
+          next if component == '.'
+          current += component
+          if current.symlink?
+            raise DownloaderError, "The archive `#{params[:http]}` contains a file written through a symbolic link: `#{name}`"
+          end
+        end
+      end
+
+      # Moves the contents of the only directory of the archive up to the
+      # destination.
+      #
+      def flatten!(destination)
+        children = destination.children
+        return unless children.size == 1 && children.first.directory? && !children.first.symlink?
+        root = destination + ".#{children.first.basename}.#{Process.pid}"
+        children.first.rename(root)
+        root.children.each { |child| child.rename(destination + child.basename) }
+        root.rmdir
+      end
+
+      # Wraps the stream of a download to update the digests of its contents
+      # as it is read, and to track the position the tar reader relies on
+      # since pipes can not tell it.
+      #
+      class DigestingStream
+        # @return [Integer] The number of bytes read so far.
+        #
+        attr_reader :pos
+
+        def initialize(io, digests)
+          @io = io
+          @digests = digests
+          @pos = 0
+        end
+
+        def read(length = nil, buffer = nil)
+          data = @io.read(length, buffer)
+          return data unless data
+          @digests.each { |digest| digest.update(data) }
+          @pos += data.bytesize
+          data
+        end
+
+        def readpartial(length, buffer = nil)
+          read(length, buffer) || raise(EOFError)
+        end
+
+        def eof?
+          @io.eof?
+        end
+      end
+    end
+  end
+end
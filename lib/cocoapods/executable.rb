@@ -19,12 +19,12 @@ module Pod
     # @return [void]
     #
     def executable(name)
-      define_method(name) do |*command|
-        Executable.execute_command(name, Array(command).flatten, false)
+      define_method(name) do |*command, **options|
+        Executable.execute_command(name, Array(command).flatten, false, **options)
       end
 
-      define_method(name.to_s + '!') do |*command|
-        Executable.execute_command(name, Array(command).flatten, true)
+      define_method(name.to_s + '!') do |*command, **options|
+        Executable.execute_command(name, Array(command).flatten, true, **options)
       end
     end
 
@@ -39,13 +39,19 @@ module Pod
     # @param  [Boolean] raise_on_failure
     #         Whether it should raise if the command fails.
     #
+    # @param  [Hash] options
+    #         The `:env` of the command, and the options of `Process.spawn`
+    #         such as `:chdir`. Unlike `ENV` and `Dir.chdir`, they do not
+    #         change the state of the whole process, so they are safe to use
+    #         from several threads.
+    #
     # @raise  If the executable could not be located.
     #
     # @raise  If the command fails and the `raise_on_failure` is set to true.
     #
     # @return [String] the output of the command (STDOUT and STDERR).
     #
-    def self.execute_command(executable, command, raise_on_failure = true)
+    def self.execute_command(executable, command, raise_on_failure = true, **options)
       bin = which!(executable)
 
       command = command.map(&:to_s)
@@ -64,7 +70,7 @@ module Pod
         stderr = Indenter.new
       end
 
-      status = popen3(bin, command, stdout, stderr)
+      status = popen3(bin, command, stdout, stderr, **options)
       stdout = stdout.join
       stderr = stderr.join
       output = stdout + stderr
@@ -170,9 +176,10 @@ module Pod
 
     private
 
-    def self.popen3(bin, command, stdout, stderr)
+    def self.popen3(bin, command, stdout, stderr, env: {}, **options)
       require 'open3'
-      Open3.popen3(bin, *command) do |i, o, e, t|
+      args = env.empty? ? [bin, *command] : [env, bin, *command]
+      Open3.popen3(*args, **options) do |i, o, e, t|
         reader(o, stdout)
         reader(e, stderr)
         i.close
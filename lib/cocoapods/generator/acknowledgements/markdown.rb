@@ -6,9 +6,7 @@ module Pod
       end
 
       def save_as(path)
-        file = File.new(path, 'w')
-        file.write(licenses)
-        file.close
+        ChangedFileWriter.open(path) { |file| write_to(file) }
       end
 
       # @return [String] The contents of the acknowledgements in Markdown format.
@@ -30,14 +28,27 @@ module Pod
       end
 
       def licenses
-        licenses_string = "#{title_from_string(header_title, 1)}\n#{header_text}\n"
+        io = StringIO.new
+        write_to(io)
+        io.string
+      end
+
+      # Writes the acknowledgements to the given IO, one Pod at a time.
+      #
+      # @param  [#<<] io
+      #         the IO to write the acknowledgements to.
+      #
+      # @return [void]
+      #
+      def write_to(io)
+        io << "#{title_from_string(header_title, 1)}\n#{header_text}\n"
         specs.each do |spec|
           if (license = string_for_spec(spec))
             license = license.force_encoding('UTF-8') if license.respond_to?(:force_encoding)
-            licenses_string += license
+            io << license
           end
         end
-        licenses_string += "#{title_from_string(footnote_title, 2)}#{footnote_text}\n"
+        io << "#{title_from_string(footnote_title, 2)}#{footnote_text}\n"
       end
     end
   end
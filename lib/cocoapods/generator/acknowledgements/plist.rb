@@ -14,12 +14,23 @@ module Pod
       # @return [String] The contents of the plist
       #
       def generate
-        plist = Nanaimo::Plist.new(plist_hash, :xml)
         contents = StringIO.new
-        Nanaimo::Writer::XMLWriter.new(plist, :pretty => true, :output => contents, :strict => false).write
+        write_to(contents)
         contents.string
       end
 
+      # Writes the plist to the given IO as it is serialized.
+      #
+      # @param  [#<<] io
+      #         the IO to write the plist to.
+      #
+      # @return [void]
+      #
+      def write_to(io)
+        plist = Nanaimo::Plist.new(plist_hash, :xml)
+        Nanaimo::Writer::XMLWriter.new(plist, :pretty => true, :output => io, :strict => false).write
+      end
+
       def plist_hash
         {
           :Title => plist_title,
@@ -0,0 +1,146 @@
+module Pod
+  module Generator
+    # Writes the contents rendered by a generator to a file as they are
+    # rendered, leaving the file untouched if its contents did not change.
+    #
+    # The rendered contents are compared with the existing file as they are
+    # written, so neither of them is ever held in memory as a whole. From the
+    # first difference on, the contents are written to a temporary file which
+    # replaces the existing one once the rendering is finished.
+    #
+    class ChangedFileWriter
+      # Renders the contents of a file with the given block.
+      #
+      # @param  [Pathname, String] path
+      #         the path of the file.
+      #
+      # @yield  [ChangedFileWriter] the writer to render the contents to.
+      #
+      # @return [Boolean] Whether the file has been written.
+      #
+      def self.open(path)
+        writer = new(path)
+        begin
+          yield writer
+        rescue Exception # rubocop:disable Lint/RescueException
+          writer.discard
+          raise
+        end
+        writer.close
+      end
+
+      # @return [Pathname] The path of the file.
+      #
+      attr_reader :path
+
+      # Initialize a new instance
+      #
+      # @param  [Pathname, String] path @see #path
+      #
+      def initialize(path)
+        @path = Pathname(path)
+        @existing = File.open(@path, 'rb') if @path.file?
+        @matched_size = 0
+        @output = nil
+        open_output unless @existing
+      end
+
+      # Writes the given strings to the file.
+      #
+      # @param  [Array<#to_s>] strings
+      #         the strings to write.
+      #
+      # @return [Integer] The number of bytes written.
+      #
+      def write(*strings)
+        strings.reduce(0) do |size, string|
+          string = string.to_s
+          write_string(string) unless string.empty?
+          size + string.bytesize
+        end
+      end
+
+      # Writes the given string to the file.
+      #
+      # @param  [#to_s] string
+      #         the string to write.
+      #
+      # @return [ChangedFileWriter] The writer.
+      #
+      def <<(string)
+        write(string)
+        self
+      end
+
+      # Writes the given string to the file, followed by a new line.
+      #
+      # @param  [#to_s] string
+      #         the string to write.
+      #
+      # @return [void]
+      #
+      def puts(string = '')
+        string = string.to_s
+        write(string)
+        write("\n") unless string.end_with?("\n")
+        nil
+      end
+
+      # Finishes writing the file.
+      #
+      # @return [Boolean] Whether the file has been written.
+      #
+      def close
+        # The new contents are shorter than the existing ones.
+        open_output if @output.nil? && !@existing.eof?
+        @existing.close if @existing
+        return false unless @output
+        @output.close
+        File.rename(temp_path, path)
+        true
+      end
+
+      # Stops writing the file, leaving it untouched.
+      #
+      # @return [void]
+      #
+      def discard
+        @existing.close if @existing && !@existing.closed?
+        return unless @output
+        @output.close unless @output.closed?
+        FileUtils.rm_f(temp_path)
+      end
+
+      private
+
+      def write_string(string)
+        unless @output
+          existing = @existing.read(string.bytesize)
+          if existing == string.b
+            @matched_size += string.bytesize
+            return
+          end
+          open_output
+        end
+        @output.write(string)
+      end
+
+      # Starts to write the temporary file which replaces the existing one,
+      # beginning with the part of the existing contents which has been
+      # matched so far. The permissions of the existing file are kept.
+      #
+      def open_output
+        path.dirname.mkpath
+        @output = File.open(temp_path, 'wb')
+        return unless @existing
+        @output.chmod(@existing.stat.mode & 0o7777)
+        @existing.rewind
+        IO.copy_stream(@existing, @output, @matched_size)
+      end
+
+      def temp_path
+        "#{path}.#{Process.pid}.tmp"
+      end
+    end
+  end
+end
@@ -32,10 +32,9 @@ module Pod
       # @return [void]
       #
       def save_as(pathname)
-        pathname.open('w') do |file|
-          file.puts(script)
-        end
+        changed = ChangedFileWriter.open(pathname) { |file| write_to(file) }
         File.chmod(0755, pathname.to_s)
+        changed
       end
 
       # @return [String] The contents of the copy resources script.
@@ -44,6 +43,36 @@ module Pod
         script
       end
 
+      # Writes the copy resources script to the given IO as it is rendered.
+      #
+      # @param  [#<<] io
+      #         the IO to write the script to.
+      #
+      # @return [void]
+      #
+      def write_to(io)
+        io << install_resources_function
+
+        resources_by_config.each do |config, resources|
+          unless resources.empty?
+            io << %(if [[ "$CONFIGURATION" == "#{config}" ]]; then\n)
+            resources.each do |resource|
+              io << %(  install_resource "#{resource}"\n)
+            end
+            io << "fi\n"
+          end
+        end
+
+        io << RSYNC_CALL
+        io << XCASSETS_COMPILE
+      end
+
+      # @return [Array] The inputs of the copy resources script.
+      #
+      def digest_inputs
+        [resources_by_config, platform.name, platform.deployment_target.to_s]
+      end
+
       private
 
       # @!group Private Helpers
@@ -74,30 +103,16 @@ module Pod
         if use_external_strings_file?
           INSTALL_RESOURCES_FUNCTION
         else
-          INSTALL_RESOURCES_FUNCTION.gsub(' --reference-external-strings-file', '')
+          INSTALL_RESOURCES_FUNCTION_WITHOUT_EXTERNAL_STRINGS_FILE
         end
       end
 
       # @return [String] The contents of the copy resources script.
       #
       def script
-        # Define install function
-        script = install_resources_function
-
-        # Call function for each configuration-dependent resource
-        resources_by_config.each do |config, resources|
-          unless resources.empty?
-            script += %(if [[ "$CONFIGURATION" == "#{config}" ]]; then\n)
-            resources.each do |resource|
-              script += %(  install_resource "#{resource}"\n)
-            end
-            script += "fi\n"
-          end
-        end
-
-        script += RSYNC_CALL
-        script += XCASSETS_COMPILE
-        script
+        io = StringIO.new
+        write_to(io)
+        io.string
       end
 
       INSTALL_RESOURCES_FUNCTION = <<EOS
@@ -189,6 +204,12 @@ EOM
 }
 EOS
 
+      # @return [String] The install resources shell function for the
+      #         platforms which do not support the external strings file.
+      #
+      INSTALL_RESOURCES_FUNCTION_WITHOUT_EXTERNAL_STRINGS_FILE =
+        INSTALL_RESOURCES_FUNCTION.gsub(' --reference-external-strings-file', '').freeze
+
       RSYNC_CALL = <<EOS
 
 mkdir -p "${TARGET_BUILD_DIR}/${UNLOCALIZED_RESOURCES_FOLDER_PATH}"
@@ -40,10 +40,9 @@ module Pod
       # @return [void]
       #
       def save_as(pathname)
-        pathname.open('w') do |file|
-          file.puts(script)
-        end
+        changed = ChangedFileWriter.open(pathname) { |file| write_to(file) }
         File.chmod(0o755, pathname.to_s)
+        changed
       end
 
       # @return [String] The contents of the embed frameworks script.
@@ -52,6 +51,43 @@ module Pod
         script
       end
 
+      # Writes the prepare artifacts script to the given IO as it is rendered.
+      #
+      # @param  [#<<] io
+      #         the IO to write the script to.
+      #
+      # @return [void]
+      #
+      def write_to(io)
+        io << SCRIPT_HEADER
+        write_variant_for_slice(io)
+        io << "\n\n"
+        write_archs_for_slice(io)
+        io << "\n\n"
+        io << INSTALL_FUNCTIONS
+        xcframeworks.each do |xcframework|
+          slices = xcframework.slices.select { |f| f.platform.symbolic_name == platform.symbolic_name }
+          next if slices.empty?
+          args = install_xcframework_args(xcframework, slices)
+          io << "install_xcframework #{args}\n"
+        end
+
+        io << "\n" unless xcframeworks.empty?
+      end
+
+      # @return [Array] The inputs of the prepare artifacts script, which
+      #         include the slices read from the xcframeworks.
+      #
+      def digest_inputs
+        xcframework_inputs = xcframeworks.map do |xcframework|
+          slices = xcframework.slices.map do |slice|
+            [slice.path.to_s, slice.platform.symbolic_name, slice.platform_variant, slice.supported_archs.sort]
+          end
+          [xcframework.path.to_s, xcframework.target_name, xcframework.build_type.framework?, slices]
+        end
+        [sandbox_root.to_s, platform.symbolic_name, xcframework_inputs]
+      end
+
       private
 
       # @!group Private Helpers
@@ -59,15 +95,25 @@ module Pod
       # @return [String] The contents of the prepare artifacts script.
       #
       def script
-        script = <<-SH.strip_heredoc
+        io = StringIO.new
+        write_to(io)
+        io.string
+      end
+
+      # @return [String] The part of the script preceding the slices of the
+      #         xcframeworks, which is the same for every target.
+      #
+      SCRIPT_HEADER = <<-SH.freeze
 #{Pod::Generator::ScriptPhaseConstants::DEFAULT_SCRIPT_PHASE_HEADER}
 
 #{Pod::Generator::ScriptPhaseConstants::RSYNC_PROTECT_TMP_FILES}
 
-#{variant_for_slice}
-
-#{archs_for_slice}
+      SH
 
+      # @return [String] The shell functions installing the xcframeworks,
+      #         which are the same for every target.
+      #
+      INSTALL_FUNCTIONS = <<-SH.freeze
 copy_dir()
 {
   local source="$1"
@@ -147,17 +193,7 @@ install_xcframework() {
   echo "Copied $source to $destination"
 }
 
-        SH
-        xcframeworks.each do |xcframework|
-          slices = xcframework.slices.select { |f| f.platform.symbolic_name == platform.symbolic_name }
-          next if slices.empty?
-          args = install_xcframework_args(xcframework, slices)
-          script << "install_xcframework #{args}\n"
-        end
-
-        script << "\n" unless xcframeworks.empty?
-        script
-      end
+      SH
 
       def shell_escape(value)
         "\"#{value}\""
@@ -175,38 +211,36 @@ install_xcframework() {
         args.join(' ')
       end
 
-      def variant_for_slice
-        script = ''
-        script << "variant_for_slice()\n"
-        script << "{\n"
-        script << "  case \"$1\" in\n"
+      def write_variant_for_slice(io)
+        io << "variant_for_slice()\n"
+        io << "{\n"
+        io << "  case \"$1\" in\n"
         xcframeworks.each do |xcframework|
           root = xcframework.path
           xcframework.slices.each do |slice|
-            script << "  #{shell_escape(root.basename.join(slice.path.dirname.relative_path_from(root)))})\n"
-            script << "    echo \"#{slice.platform_variant}\"\n"
-            script << "    ;;\n"
+            io << "  #{shell_escape(root.basename.join(slice.path.dirname.relative_path_from(root)))})\n"
+            io << "    echo \"#{slice.platform_variant}\"\n"
+            io << "    ;;\n"
           end
         end
-        script << "  esac\n"
-        script << '}'
+        io << "  esac\n"
+        io << '}'
       end
 
-      def archs_for_slice
-        script = ''
-        script << "archs_for_slice()\n"
-        script << "{\n"
-        script << "  case \"$1\" in\n"
+      def write_archs_for_slice(io)
+        io << "archs_for_slice()\n"
+        io << "{\n"
+        io << "  case \"$1\" in\n"
         xcframeworks.each do |xcframework|
           root = xcframework.path
           xcframework.slices.each do |slice|
-            script << "  #{shell_escape(root.basename.join(slice.path.dirname.relative_path_from(root)))})\n"
-            script << "    echo \"#{slice.supported_archs.sort.join(' ')}\"\n"
-            script << "    ;;\n"
+            io << "  #{shell_escape(root.basename.join(slice.path.dirname.relative_path_from(root)))})\n"
+            io << "    echo \"#{slice.supported_archs.sort.join(' ')}\"\n"
+            io << "    ;;\n"
           end
         end
-        script << "  esac\n"
-        script << '}'
+        io << "  esac\n"
+        io << '}'
       end
 
       class << self
@@ -26,6 +26,12 @@ module Pod
           source.write(generate)
         end
       end
+
+      # @return [Array] The inputs of the dummy source file.
+      #
+      def digest_inputs
+        [class_name]
+      end
     end
   end
 end
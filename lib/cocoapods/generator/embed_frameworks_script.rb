@@ -32,10 +32,9 @@ module Pod
       # @return [void]
       #
       def save_as(pathname)
-        pathname.open('w') do |file|
-          file.puts(script)
-        end
+        changed = ChangedFileWriter.open(pathname) { |file| write_to(file) }
         File.chmod(0755, pathname.to_s)
+        changed
       end
 
       # @return [String] The contents of the embed frameworks script.
@@ -44,6 +43,54 @@ module Pod
         script
       end
 
+      # Writes the embed frameworks script to the given IO as it is rendered.
+      #
+      # @param  [#<<] io
+      #         the IO to write the script to.
+      #
+      # @return [void]
+      #
+      def write_to(io)
+        io << SCRIPT_HEADER
+        contents_by_config = Hash.new do |hash, key|
+          hash[key] = ''
+        end
+        frameworks_by_config.each do |config, frameworks|
+          frameworks.each do |framework|
+            contents_by_config[config] << %(  install_framework "#{framework.source_path}"\n)
+          end
+        end
+        xcframeworks_by_config.each do |config, xcframeworks|
+          xcframeworks.select { |xcf| xcf.build_type.dynamic_framework? }.each do |xcframework|
+            target_name = xcframework.target_name
+            name = xcframework.name
+            contents_by_config[config] << %(  install_framework "#{Target::BuildSettings::XCFRAMEWORKS_BUILD_DIR_VARIABLE}/#{target_name}/#{name}.framework"\n)
+          end
+        end
+        io << "\n" unless contents_by_config.empty?
+        contents_by_config.keys.sort.each do |config|
+          contents = contents_by_config[config]
+          next if contents.empty?
+          io << %(if [[ "$CONFIGURATION" == "#{config}" ]]; then\n)
+          io << contents
+          io << "fi\n"
+        end
+        io << SCRIPT_FOOTER
+      end
+
+      # @return [Array] The inputs of the embed frameworks script, which are
+      #         the paths of the frameworks to embed for each configuration.
+      #
+      def digest_inputs
+        frameworks = frameworks_by_config.map do |config, framework_paths|
+          [config, framework_paths.map { |framework| framework.source_path.to_s }]
+        end
+        xcframeworks = xcframeworks_by_config.map do |config, config_xcframeworks|
+          [config, config_xcframeworks.map { |xcf| [xcf.target_name, xcf.name, xcf.build_type.dynamic_framework?] }]
+        end
+        [frameworks, xcframeworks]
+      end
+
       private
 
       # @!group Private Helpers
@@ -51,7 +98,15 @@ module Pod
       # @return [String] The contents of the embed frameworks script.
       #
       def script
-        script = <<-SH.strip_heredoc
+        io = StringIO.new
+        write_to(io)
+        io.string
+      end
+
+      # @return [String] The part of the script preceding the frameworks,
+      #         which is the same for every target.
+      #
+      SCRIPT_HEADER = <<-SH.strip_heredoc.freeze
 #{Pod::Generator::ScriptPhaseConstants::DEFAULT_SCRIPT_PHASE_HEADER}
 if [ -z ${FRAMEWORKS_FOLDER_PATH+x} ]; then
   # If FRAMEWORKS_FOLDER_PATH is not set, then there's nowhere for us to copy
@@ -148,37 +203,15 @@ code_sign_if_enabled() {
     eval "$code_sign_cmd"
   fi
 }
-        SH
-        contents_by_config = Hash.new do |hash, key|
-          hash[key] = ''
-        end
-        frameworks_by_config.each do |config, frameworks|
-          frameworks.each do |framework|
-            contents_by_config[config] << %(  install_framework "#{framework.source_path}"\n)
-          end
-        end
-        xcframeworks_by_config.each do |config, xcframeworks|
-          xcframeworks.select { |xcf| xcf.build_type.dynamic_framework? }.each do |xcframework|
-            target_name = xcframework.target_name
-            name = xcframework.name
-            contents_by_config[config] << %(  install_framework "#{Target::BuildSettings::XCFRAMEWORKS_BUILD_DIR_VARIABLE}/#{target_name}/#{name}.framework"\n)
-          end
-        end
-        script << "\n" unless contents_by_config.empty?
-        contents_by_config.keys.sort.each do |config|
-          contents = contents_by_config[config]
-          next if contents.empty?
-          script << %(if [[ "$CONFIGURATION" == "#{config}" ]]; then\n)
-          script << contents
-          script << "fi\n"
-        end
-        script << <<-SH.strip_heredoc
+      SH
+
+      # @return [String] The part of the script following the frameworks.
+      #
+      SCRIPT_FOOTER = <<-SH.strip_heredoc.freeze
         if [ "${COCOAPODS_PARALLEL_CODE_SIGN}" == "true" ]; then
           wait
         fi
-        SH
-        script
-      end
+      SH
 
       # @param  [Xcode::FrameworkPaths] framework_path
       #         the framework path containing the dSYM
@@ -24,6 +24,20 @@ module Pod
         paths.join("\n")
       end
 
+      # Writes the file list to the given IO, one path at a time.
+      #
+      # @param  [#<<] io
+      #         the IO to write the file list to.
+      #
+      # @return [void]
+      #
+      def write_to(io)
+        paths.each_with_index do |path, index|
+          io << "\n" unless index.zero?
+          io << path.to_s
+        end
+      end
+
       # Generates and saves the file list to the given path.
       #
       # @param  [Pathname] path
@@ -32,7 +46,13 @@ module Pod
       # @return [void]
       #
       def save_as(path)
-        path.open('w') { |file_list| file_list.write(generate) }
+        ChangedFileWriter.open(path) { |file_list| write_to(file_list) }
+      end
+
+      # @return [Array] The inputs of the file list.
+      #
+      def digest_inputs
+        paths.map(&:to_s)
       end
     end
   end
@@ -44,10 +44,7 @@ module Pod
       # @return [void]
       #
       def save_as(path)
-        contents = generate
-        path.open('w') do |f|
-          f.write(contents)
-        end
+        ChangedFileWriter.open(path) { |f| write_to(f) }
       end
 
       # Generates the contents of the Info.plist
@@ -58,24 +55,40 @@ module Pod
         to_plist(info)
       end
 
+      # Writes the Info.plist to the given IO as it is serialized.
+      #
+      # @param  [#<<] io
+      #         the IO to write the Info.plist to.
+      #
+      # @return [void]
+      #
+      def write_to(io)
+        io << HEADER
+        serialize(info, io)
+        io << FOOTER
+      end
+
+      # @return [Array] The inputs of the Info.plist, which determine its
+      #         contents.
+      #
+      def digest_inputs
+        [version.to_s, platform.to_s, bundle_package_type.to_s, additional_entries]
+      end
+
       private
 
-      def header
-        <<-PLIST
+      HEADER = <<-PLIST.freeze
 <?xml version="1.0" encoding="UTF-8"?>
 <!DOCTYPE plist PUBLIC "-//Apple//DTD PLIST 1.0//EN" "http://www.apple.com/DTDs/PropertyList-1.0.dtd">
 <plist version="1.0">
-        PLIST
-      end
+      PLIST
 
-      def footer
-        <<-PLIST
+      FOOTER = <<-PLIST.freeze
 </plist>
-        PLIST
-      end
+      PLIST
 
       def to_plist(root)
-        serialize(root, header) << footer
+        serialize(root, HEADER.dup) << FOOTER
       end
 
       def serialize(value, output, indentation = 0)
@@ -170,7 +170,11 @@ module Pod
         integrate
       end
       write_lockfiles
+      write_path_list_snapshots
+      write_binary_metadata_cache
       perform_post_install_actions
+    ensure
+      Xcode::BinaryMetadataCache.shared = nil
     end
 
     def show_skip_pods_project_generation_message
@@ -225,6 +229,7 @@ module Pod
       UI.message 'Preparing' do
         deintegrate_if_different_major_version
         sandbox.prepare
+        Xcode::BinaryMetadataCache.shared = Xcode::BinaryMetadataCache.from_file(sandbox.binary_metadata_cache_path)
         ensure_plugins_are_installed!
         run_plugins_pre_install_hooks
       end
@@ -300,8 +305,8 @@ module Pod
       aggregate_targets_to_generate = cache_analysis_result.aggregate_targets_to_generate
 
       pod_targets_to_generate.each do |pod_target|
-        pod_target.build_headers.implode_path!(pod_target.headers_sandbox)
-        sandbox.public_headers.implode_path!(pod_target.headers_sandbox)
+        pod_target.build_headers.reconcile_path!(pod_target.headers_sandbox)
+        sandbox.public_headers.reconcile_path!(pod_target.headers_sandbox)
       end
 
       create_and_save_projects(pod_targets_to_generate, aggregate_targets_to_generate,
@@ -510,6 +515,11 @@ module Pod
 
       sorted_root_specs = root_specs.sort_by(&:name)
 
+      # Overlap downloading and installing of every pod if the option is set
+      if installation_options.parallel_pod_installation
+        return install_pod_sources_in_pipeline(sorted_root_specs, pods_to_install, title_options)
+      end
+
       # Download pods in parallel before installing if the option is set
       if installation_options.parallel_pod_downloads
         require 'concurrent/executor/fixed_thread_pool'
@@ -546,6 +556,90 @@ module Pod
       end
     end
 
+    # Downloads and installs the Pods which need to be installed in a staged
+    # pipeline, so that each Pod is installed as soon as its own download
+    # finished instead of waiting for every other download.
+    #
+    # Each stage runs on its own bounded thread pool. The installers are
+    # created and the results are collected on the calling thread in the order
+    # of `sorted_root_specs`, which keeps both the output and the list of
+    # installers deterministic.
+    #
+    # @param  [Array<Specification>] sorted_root_specs
+    #         the root specs of all the Pods, sorted by name.
+    #
+    # @param  [Array<String>] pods_to_install
+    #         the names of the Pods which need to be installed.
+    #
+    # @param  [Hash] title_options
+    #         the options used to print the section of each Pod.
+    #
+    # @return [void]
+    #
+    def install_pod_sources_in_pipeline(sorted_root_specs, pods_to_install, title_options)
+      require 'concurrent/executor/fixed_thread_pool'
+      require 'concurrent/promises'
+
+      download_pool = Concurrent::FixedThreadPool.new(installation_options.parallel_pod_download_thread_pool_size, :idletime => 300)
+      install_pool = Concurrent::FixedThreadPool.new(installation_options.parallel_pod_installation_thread_pool_size, :idletime => 300)
+
+      installs = sorted_root_specs.map do |spec|
+        pod_installer = create_pod_installer(spec.name)
+        next [spec, pod_installer, nil] unless pods_to_install.include?(spec.name)
+
+        future = Concurrent::Promises.future_on(download_pool, spec.name) do |pod_name|
+          download_source_of_pod(pod_name)
+        end.then_on(install_pool) do
+          pod_installer.install!
+        end
+        [spec, pod_installer, future]
+      end
+
+      installs.each do |spec, pod_installer, future|
+        if future
+          title = section_title(spec, 'Installing')
+          UI.titled_section(title.green, title_options) do
+            future.value!
+            @installed_specs.concat(pod_installer.specs_by_platform.values.flatten.uniq)
+          end
+        else
+          UI.section("Using #{spec}", title_options[:verbose_prefix])
+        end
+      end
+    ensure
+      [download_pool, install_pool].compact.each do |pool|
+        pool.shutdown
+        pool.wait_for_termination
+      end
+    end
+
+    # Yields each of the given Pod installers, concurrently on a bounded
+    # thread pool if the `parallel_pod_installation` option is set.
+    #
+    # @param  [Array<PodSourceInstaller>] installers
+    #         the installers to yield.
+    #
+    # @return [void]
+    #
+    def each_pod_installer(installers, &block)
+      unless installation_options.parallel_pod_installation
+        installers.each(&block)
+        return
+      end
+
+      require 'concurrent/executor/fixed_thread_pool'
+      require 'concurrent/promises'
+
+      pool = Concurrent::FixedThreadPool.new(installation_options.parallel_pod_installation_thread_pool_size, :idletime => 300)
+      futures = installers.map { |installer| Concurrent::Promises.future_on(pool, installer, &block) }
+      futures.each(&:value!)
+    ensure
+      if pool
+        pool.shutdown
+        pool.wait_for_termination
+      end
+    end
+
     def section_title(spec, current_action)
       if sandbox_state.changed.include?(spec.name) && sandbox.manifest
         current_version = spec.version
@@ -639,13 +733,13 @@ module Pod
     def clean_pod_sources
       return unless installation_options.clean?
       return if installed_specs.empty?
-      pod_installers.each(&:clean!)
+      each_pod_installer(pod_installers, &:clean!)
     end
 
     # Unlocks the sources of the Pods.
     #
     def unlock_pod_sources
-      pod_installers.each do |installer|
+      each_pod_installer(pod_installers) do |installer|
         pod_target = pod_targets.find { |target| target.pod_name == installer.name }
         installer.unlock_files!(pod_target.file_accessors)
       end
@@ -655,7 +749,7 @@ module Pod
     #
     def lock_pod_sources
       return unless installation_options.lock_pod_sources?
-      pod_installers.each do |installer|
+      each_pod_installer(pod_installers) do |installer|
         pod_target = pod_targets.find { |target| target.pod_name == installer.name }
         installer.lock_files!(pod_target.file_accessors)
       end
@@ -891,6 +985,51 @@ module Pod
       end
     end
 
+    # Stores a snapshot of the file listing of the Pods which have not been
+    # loaded from a valid one, keyed by the freshly written manifest.
+    #
+    # @note   The path lists of the installed Pods are refreshed while
+    #         generating the Pods project, so they are only read again when
+    #         the generation has been skipped.
+    #
+    # @return [void]
+    #
+    def write_path_list_snapshots
+      return unless installation_options.path_list_snapshots?
+      installed_pods = sandbox_state.added | sandbox_state.changed
+      UI.message '- Writing path list snapshots' do
+        pod_targets.uniq(&:pod_name).each do |pod_target|
+          pod_name = pod_target.pod_name
+          next if sandbox.local?(pod_name)
+          next unless key = Sandbox::PathListSnapshot.key_for(lockfile, pod_name)
+          path_list = pod_target.file_accessors.first&.path_list
+          next if path_list.nil? || !path_list.root.exist?
+          next if path_list.loaded_from_snapshot? && path_list.snapshot.key == key
+          snapshot = Sandbox::PathListSnapshot.new(sandbox.path_list_snapshot_path(pod_name), key)
+          # The path list of a Pod which has not been installed again may not
+          # have been loaded, in which case its stored snapshot is checked
+          # instead of loading it.
+          next if !installed_pods.include?(pod_name) && snapshot.valid?
+          if installation_options.skip_pods_project_generation? && installed_pods.include?(pod_name)
+            path_list.read_file_system
+          end
+          snapshot.save(path_list.files, path_list.dirs)
+        end
+      end
+    end
+
+    # Stores the analysis of the vendored binaries and XCFrameworks made
+    # during the installation.
+    #
+    # @return [void]
+    #
+    def write_binary_metadata_cache
+      return unless cache = Xcode::BinaryMetadataCache.shared
+      UI.message "- Writing binary metadata cache in #{UI.path cache.path}" do
+        cache.save!
+      end
+    end
+
     # @param [ProjectCacheAnalysisResult] cache_analysis_result
     #        The cache analysis result for the current installation.
     #
@@ -13,6 +13,7 @@ module Pod
       autoload :PodfileDependencyCache,    'cocoapods/installer/analyzer/podfile_dependency_cache'
       autoload :PodVariant,                'cocoapods/installer/analyzer/pod_variant'
       autoload :PodVariantSet,             'cocoapods/installer/analyzer/pod_variant_set'
+      autoload :ResolutionCache,           'cocoapods/installer/analyzer/resolution_cache'
       autoload :SandboxAnalyzer,           'cocoapods/installer/analyzer/sandbox_analyzer'
       autoload :SpecsState,                'cocoapods/installer/analyzer/specs_state'
       autoload :TargetInspectionResult,    'cocoapods/installer/analyzer/target_inspection_result'
@@ -127,6 +128,7 @@ module Pod
         specifications = generate_specifications(resolver_specs_by_target)
         aggregate_targets, pod_targets = generate_targets(resolver_specs_by_target, target_inspections)
         sandbox_state = generate_sandbox_state(specifications)
+        attach_path_list_snapshots(pod_targets, sandbox_state) if installation_options.path_list_snapshots?
         specs_by_target = resolver_specs_by_target.each_with_object({}) do |rspecs_by_target, hash|
           hash[rspecs_by_target[0]] = rspecs_by_target[1].map(&:spec)
         end
@@ -840,6 +842,30 @@ module Pod
         end
       end
 
+      # Attaches the snapshots stored in the sandbox to the path lists of the
+      # Pods which will not be touched by the installation, so that their file
+      # system does not need to be walked again.
+      #
+      # @param [Array<PodTarget>] pod_targets
+      #        the pod targets whose path lists should use a snapshot.
+      #
+      # @param [SpecsState] sandbox_state
+      #        the state of the sandbox respect to the resolved specifications.
+      #
+      # @return [void]
+      #
+      def attach_path_list_snapshots(pod_targets, sandbox_state)
+        pod_targets.each do |pod_target|
+          pod_name = pod_target.pod_name
+          next unless sandbox_state.unchanged.include?(pod_name)
+          next if sandbox.local?(pod_name) || sandbox.predownloaded?(pod_name)
+          next unless key = Sandbox::PathListSnapshot.key_for(sandbox.manifest, pod_name)
+          pod_target.file_accessors.map(&:path_list).uniq.each do |path_list|
+            path_list.snapshot ||= Sandbox::PathListSnapshot.new(sandbox.path_list_snapshot_path(pod_name), key)
+          end
+        end
+      end
+
       # Calculates and returns the platform to use for the given list specs and target definitions.
       #
       # @note The platform is only determined by all library specs and ignores non library ones. Subspecs are always
@@ -1078,13 +1104,34 @@ module Pod
 
         resolver_specs_by_target = nil
         UI.section "Resolving dependencies of #{UI.path(podfile.defined_in_file) || 'Podfile'}" do
-          resolver = Pod::Resolver.new(sandbox, podfile, locked_dependencies, sources, @specs_updated, :sources_manager => sources_manager)
-          resolver_specs_by_target = resolver.resolve
+          cache = resolution_cache(locked_dependencies)
+          if cache && !@specs_updated
+            resolver_specs_by_target = cache.load(@podfile_dependency_cache.target_definition_list, sources, sandbox)
+            UI.message 'Using the resolution of the previous installation' if resolver_specs_by_target
+          end
+          unless resolver_specs_by_target
+            resolver = Pod::Resolver.new(sandbox, podfile, locked_dependencies, sources, @specs_updated, :sources_manager => sources_manager)
+            resolver_specs_by_target = resolver.resolve
+            cache.store(resolver_specs_by_target) if cache
+          end
           resolver_specs_by_target.values.flatten(1).map(&:spec).each(&:validate_cocoapods_version)
         end
         resolver_specs_by_target
       end
 
+      # @param  [Molinillo::DependencyGraph<Dependency>] locked_dependencies
+      #         the dependencies locked by the Lockfile.
+      #
+      # @return [ResolutionCache, Nil] The cache of the resolution for the
+      #         current inputs, if the resolution should be cached. Updates
+      #         never use the cache since they are meant to pick new versions.
+      #
+      def resolution_cache(locked_dependencies)
+        return unless installation_options.resolution_cache? && !update_mode?
+        digest = ResolutionCache.digest(podfile, locked_dependencies, sources, sandbox)
+        ResolutionCache.new(sandbox.resolution_cache_path, digest)
+      end
+
       # Warns for any specification that is incompatible with its target.
       #
       # @param  [Hash{TargetDefinition => Array<Specification>}] resolver_specs_by_target
@@ -0,0 +1,163 @@
+require 'digest'
+require 'json'
+
+module Pod
+  class Installer
+    class Analyzer
+      # Stores the result of the last dependency resolution in the sandbox,
+      # along with a digest of everything the resolution depends on, so that
+      # installations whose inputs did not change can skip the resolver.
+      #
+      # The resolved specifications are stored by name, version and source,
+      # and are loaded again from their source when the cache is used.
+      #
+      class ResolutionCache
+        # @return [Integer] The version of the serialization format. Caches
+        #         saved with a different version are ignored.
+        #
+        FORMAT_VERSION = 1
+
+        # @return [Pathname] The path of the file the cache is stored in.
+        #
+        attr_reader :path
+
+        # @return [String] The digest of the inputs of the resolution.
+        #
+        attr_reader :digest
+
+        # Initialize a new instance
+        #
+        # @param  [Pathname] path @see #path
+        # @param  [String] digest @see #digest
+        #
+        def initialize(path, digest)
+          @path = path
+          @digest = digest
+        end
+
+        # Computes the digest of the inputs of a resolution.
+        #
+        # @param  [Podfile] podfile
+        #         the Podfile, which includes the installation options and
+        #         the plugins.
+        #
+        # @param  [Molinillo::DependencyGraph] locked_dependencies
+        #         the dependencies locked by the Lockfile.
+        #
+        # @param  [Array<Source>] sources
+        #         the sources used by the resolution.
+        #
+        # @param  [Sandbox] sandbox
+        #         the sandbox storing the specifications of the Pods with an
+        #         external source.
+        #
+        # @return [String]
+        #
+        def self.digest(podfile, locked_dependencies, sources, sandbox)
+          locked = locked_dependencies.map do |vertex|
+            dependency = vertex.payload
+            [vertex.name, dependency.to_s, dependency && dependency.podspec_repo]
+          end
+          external_specs = sandbox.specifications_root.children.sort.map do |path|
+            [path.basename.to_s, Digest::SHA256.file(path).hexdigest]
+          end if sandbox.specifications_root.directory?
+          inputs = [
+            FORMAT_VERSION,
+            Pod::VERSION,
+            podfile.to_hash,
+            locked.sort,
+            sources.map { |source| [source.name, source.url, source_revision(source)] },
+            external_specs || [],
+          ]
+          Digest::SHA256.hexdigest(inputs.to_json)
+        end
+
+        # @param  [Source] source
+        #         a spec repo.
+        #
+        # @return [String] The commit checked out in the given source, or the
+        #         modification time of the source if it is not a git
+        #         repository.
+        #
+        def self.source_revision(source)
+          git_dir = source.repo + '.git'
+          return source.repo.mtime.to_f.to_s unless (git_dir + 'HEAD').file?
+          head = (git_dir + 'HEAD').read.strip
+          return head unless head.start_with?('ref: ')
+          ref = head[5..-1]
+          return (git_dir + ref).read.strip if (git_dir + ref).file?
+          packed_refs = git_dir + 'packed-refs'
+          line = packed_refs.each_line.find { |l| l.chomp.end_with?(" #{ref}") } if packed_refs.file?
+          line ? line.split(' ').first : head
+        rescue SystemCallError
+          nil
+        end
+
+        # Loads the resolved specifications stored for the current digest.
+        #
+        # @param  [Array<Podfile::TargetDefinition>] target_definitions
+        #         the target definitions of the Podfile.
+        #
+        # @param  [Array<Source>] sources
+        #         the sources the specifications may come from.
+        #
+        # @param  [Sandbox] sandbox
+        #         the sandbox storing the specifications of the Pods with an
+        #         external source.
+        #
+        # @return [Hash{Podfile::TargetDefinition => Array<Resolver::ResolverSpecification>}, Nil]
+        #         The resolved specifications grouped by target, or nil if
+        #         there are none for the current digest or they can not be
+        #         loaded anymore.
+        #
+        def load(target_definitions, sources, sandbox)
+          return unless path.file?
+          version, digest, specs_by_label = Marshal.load(File.binread(path))
+          return unless version == FORMAT_VERSION && digest == self.digest
+
+          target_definitions_by_label = Hash[target_definitions.map { |target| [target.label, target] }]
+          sources_by_name = Hash[sources.map { |source| [source.name, source] }]
+          specs = {}
+          Hash[specs_by_label.map do |label, resolved_specs|
+            target = target_definitions_by_label.fetch(label)
+            resolver_specs = resolved_specs.map do |name, version_string, source_name, non_library|
+              source = source_name && sources_by_name.fetch(source_name)
+              spec = specs[[name, version_string, source_name]] ||= begin
+                root_name = Specification.root_name(name)
+                root_spec = source ? source.specification(root_name, version_string) : sandbox.specification(root_name)
+                raise Informative, "Unable to find #{root_name} (#{version_string})" unless root_spec && root_spec.version.to_s == version_string
+                root_spec.subspec_by_name(name, true, true)
+              end
+              Resolver::ResolverSpecification.new(spec, non_library, source || false)
+            end
+            [target, resolver_specs]
+          end]
+        rescue StandardError => e
+          UI.message "Ignoring the resolution cache: #{e.message}"
+          nil
+        end
+
+        # Stores the given resolved specifications for the current digest.
+        #
+        # @param  [Hash{Podfile::TargetDefinition => Array<Resolver::ResolverSpecification>}] resolver_specs_by_target
+        #         the resolved specifications grouped by target.
+        #
+        # @return [void]
+        #
+        def store(resolver_specs_by_target)
+          specs_by_label = Hash[resolver_specs_by_target.map do |target, resolver_specs|
+            [target.label, resolver_specs.map do |resolver_spec|
+              source = resolver_spec.source
+              [resolver_spec.name, resolver_spec.spec.version.to_s, source ? source.name : nil,
+               resolver_spec.used_by_non_library_targets_only?]
+            end]
+          end]
+          path.dirname.mkpath
+          temp_path = "#{path}.#{Process.pid}.tmp"
+          File.binwrite(temp_path, Marshal.dump([FORMAT_VERSION, digest, specs_by_label]))
+          File.rename(temp_path, path)
+        end
+      end
+    end
+  end
+end
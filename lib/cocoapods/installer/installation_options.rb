@@ -182,11 +182,52 @@ module Pod
       #
       option :generate_multiple_pod_projects, false
 
+      # Whether to serialize the generated Xcode projects in parallel, using forked processes. Most useful together
+      # with `generate_multiple_pod_projects`, and ignored on platforms that do not support forking.
+      #
+      option :parallel_project_writing, false
+
+      # The maximum number of processes used to write the Xcode projects. Only takes effect when
+      # `parallel_project_writing` is `true`.
+      #
+      # Default: 4
+      #
+      option(:parallel_project_writing_process_count, 4, :boolean => false)
+
+      # Whether to install the targets of the pod projects concurrently, on a thread pool, when
+      # `generate_multiple_pod_projects` is enabled. The file references of the pods, which share the header
+      # symlinks of the sandbox, and the dependencies between the projects are still installed serially.
+      #
+      option :parallel_pod_target_installation, false
+
+      # The size of the thread pool used to install the targets of the pod projects. Only takes effect when
+      # `parallel_pod_target_installation` is `true`.
+      #
+      # Default: 8
+      #
+      option(:parallel_pod_target_installation_thread_pool_size, 8, :boolean => false)
+
       # Whether to enable only regenerating targets and their associate projects that have changed
       # since the previous installation.
       #
       option :incremental_installation, false
 
+      # Whether to store a snapshot of the file listing of every pod in the sandbox, so that the file system of pods
+      # that did not change since the previous installation does not need to be read again.
+      #
+      # The snapshots are keyed by the checksum and the checkout options of each pod stored in the `Manifest.lock`.
+      # Development pods never use a snapshot.
+      #
+      option :path_list_snapshots, false
+
+      # Whether to store the result of the dependency resolution in the sandbox, and to use it instead of resolving
+      # the dependencies again as long as the Podfile, the locked dependencies, the revisions of the sources and the
+      # podspecs of the external sources did not change.
+      #
+      # The cache is never used when updating pods or after updating the spec repos.
+      #
+      option :resolution_cache, false
+
       # Whether to skip generating the `Pods.xcodeproj` and perform only dependency resolution and downloading.
       #
       option :skip_pods_project_generation, false
@@ -201,6 +242,21 @@ module Pod
       # Default: 40
       #
       option(:parallel_pod_download_thread_pool_size, 40, :boolean => false)
+
+      # Whether to install pods in a staged pipeline, so that every pod is prepared as soon as its own download
+      # finished, and to clean and lock the sources of the pods in parallel.
+      #
+      # Downloads use `parallel_pod_download_thread_pool_size` workers, every other stage uses
+      # `parallel_pod_installation_thread_pool_size` workers.
+      #
+      option :parallel_pod_installation, false
+
+      # The size of the thread pool used for each stage after downloading when installing pods in parallel. Only
+      # takes effect when `parallel_pod_installation` is `true`.
+      #
+      # Default: 8
+      #
+      option(:parallel_pod_installation_thread_pool_size, 8, :boolean => false)
     end
   end
 end
@@ -89,6 +89,7 @@ module Pod
       def lock_files!(file_accessors)
         return if local?
         unlocked_files = source_files(file_accessors).reject { |f| (File.stat(f).mode & 0o200).zero? }
+        unshare_files!(unlocked_files)
         FileUtils.chmod('u-w', unlocked_files)
       end
 
@@ -98,7 +99,9 @@ module Pod
       #
       def unlock_files!(file_accessors)
         return if local?
-        FileUtils.chmod('u+w', source_files(file_accessors))
+        files = source_files(file_accessors)
+        unshare_files!(files)
+        FileUtils.chmod('u+w', files)
       end
 
       #-----------------------------------------------------------------------#
@@ -192,6 +195,22 @@ module Pod
         file_accessors.flat_map(&:source_files)
       end
 
+      # Replaces the given files by copies if they are hard links, as when the
+      # Pod is linked from the download cache, so that changing their
+      # permissions does not change the files of the cache.
+      #
+      # @return [void]
+      #
+      def unshare_files!(files)
+        files.each do |file|
+          path = File.realpath(file)
+          next unless File.stat(path).nlink > 1
+          temp_path = "#{path}.#{Process.pid}.tmp"
+          FileUtils.cp(path, temp_path, :preserve => true)
+          File.rename(temp_path, path)
+        end
+      end
+
       #-----------------------------------------------------------------------#
     end
   end
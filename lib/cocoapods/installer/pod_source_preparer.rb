@@ -52,22 +52,18 @@ module Pod
       #         shell script to avoid issues with relative paths
       #         (issue #1694).
       #
+      # @note   The working directory and the environment are only set for
+      #         the script, since the Pods are prepared concurrently.
+      #
       # @return [void]
       #
       def run_prepare_command
         return unless spec.prepare_command
         UI.section(' > Running prepare command', '', 1) do
-          Dir.chdir(path) do
-            begin
-              ENV.delete('CDPATH')
-              ENV['COCOAPODS_VERSION'] = Pod::VERSION
-              prepare_command = spec.prepare_command.strip_heredoc.chomp
-              full_command = "\nset -e\n" + prepare_command
-              bash!('-c', full_command)
-            ensure
-              ENV.delete('COCOAPODS_VERSION')
-            end
-          end
+          prepare_command = spec.prepare_command.strip_heredoc.chomp
+          full_command = "\nset -e\n" + prepare_command
+          env = { 'CDPATH' => nil, 'COCOAPODS_VERSION' => Pod::VERSION }
+          bash!('-c', full_command, :env => env, :chdir => path.to_s)
         end
       end
 
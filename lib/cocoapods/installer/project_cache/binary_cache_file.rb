@@ -0,0 +1,213 @@
+require 'fileutils'
+
+module Pod
+  class Installer
+    module ProjectCache
+      # Reads and writes the compact binary format of the project cache files.
+      #
+      # A file starts with a magic string, the version of the format and the size of its header, followed by the
+      # header itself and the serialized entries. The header holds the values shared by every target and an index
+      # of the offset and size of each entry, so that entries are only decoded when they are looked up.
+      #
+      module BinaryCacheFile
+        # @return [String] The magic string every binary cache file starts with.
+        #
+        MAGIC = 'CPPC'.b.freeze
+
+        # @return [Integer] The version of the binary format.
+        #
+        FORMAT_VERSION = 1
+
+        # @return [Integer] The size of the preamble preceding the header.
+        #
+        PREAMBLE_SIZE = MAGIC.bytesize + 8
+
+        # @param  [String, Pathname] path
+        #         The path of the cache file.
+        #
+        # @return [Boolean] Whether the file at the given path is a binary cache file.
+        #
+        def self.binary?(path)
+          File.file?(path) && File.binread(path, MAGIC.bytesize) == MAGIC
+        end
+
+        # @param  [String, Pathname] path
+        #         The path of a binary cache file.
+        #
+        # @return [Pathname] The path of the YAML file the cache was stored in before the binary format was
+        #         introduced.
+        #
+        def self.legacy_yaml_path(path)
+          Pathname("#{path}.yaml")
+        end
+
+        # Serializes a cache file.
+        #
+        # @param  [Object] header
+        #         The values shared by all the entries.
+        #
+        # @param  [Hash{String => String}] entries
+        #         The serialized entries, keyed by target label.
+        #
+        # @return [String] The contents of the cache file.
+        #
+        def self.dump(header, entries)
+          index = {}
+          body = String.new(:encoding => Encoding::BINARY)
+          entries.each do |key, data|
+            index[key] = [body.bytesize, data.bytesize]
+            body << data
+          end
+          header_data = Marshal.dump([header, index])
+          MAGIC + [FORMAT_VERSION, header_data.bytesize].pack('NN') + header_data + body
+        end
+
+        # Loads a cache file without decoding its entries.
+        #
+        # @param  [String, Pathname] path
+        #         The path of the cache file.
+        #
+        # @return [Array(Object, Hash{String => String}), Nil] The header and the serialized entries keyed by target
+        #         label, or nil if the file is not a valid binary cache file of the current format version.
+        #
+        def self.load(path)
+          data = File.binread(path)
+          return unless data.start_with?(MAGIC)
+          version, header_size = data.byteslice(MAGIC.bytesize, 8).unpack('NN')
+          return unless version == FORMAT_VERSION
+          header, index = Marshal.load(data.byteslice(PREAMBLE_SIZE, header_size))
+          body_offset = PREAMBLE_SIZE + header_size
+          entries = Hash[index.map { |key, (offset, size)| [key, data.byteslice(body_offset + offset, size)] }]
+          [header, entries]
+        rescue StandardError
+          nil
+        end
+
+        # Writes a cache file if its contents changed, and removes the legacy YAML file it replaces.
+        #
+        # @param  [String, Pathname] path
+        #         The path of the cache file.
+        #
+        # @param  [Object] header
+        #         @see #dump
+        #
+        # @param  [Hash{String => String}] entries
+        #         @see #dump
+        #
+        # @return [void]
+        #
+        def self.write(path, header, entries)
+          Pathname(path).dirname.mkpath
+          Sandbox.update_changed_file(Pathname(path), dump(header, entries))
+          FileUtils.rm_f(legacy_yaml_path(path))
+        end
+
+        # Serializes the entries of a cache.
+        #
+        # @param  [Hash{String => Object}, LazyEntries] entries
+        #         The entries to serialize.
+        #
+        # @yield  [Object] the entry to convert to a plain hash before serializing it.
+        #
+        # @return [Hash{String => String}]
+        #
+        def self.serialize_entries(entries, &to_hash)
+          return entries.serialize(&to_hash) if entries.is_a?(LazyEntries)
+          Hash[entries.map { |key, value| [key, Marshal.dump(to_hash.call(value))] }]
+        end
+
+        # A hash-like collection of the entries of a binary cache file, which decodes each entry the first time it
+        # is looked up.
+        #
+        class LazyEntries
+          include Enumerable
+
+          # Initialize a new instance
+          #
+          # @param  [Hash{String => String}] raw_entries
+          #         The serialized entries keyed by target label.
+          #
+          # @yield  [Hash] the plain hash of an entry to convert to its cache object.
+          #
+          def initialize(raw_entries, &decoder)
+            @raw_entries = raw_entries
+            @entries = {}
+            @decoder = decoder
+          end
+
+          # @return [Object, Nil] The decoded entry for the given label.
+          #
+          def [](key)
+            return @entries[key] if @entries.key?(key)
+            return unless raw = @raw_entries[key]
+            @entries[key] = @decoder.call(Marshal.load(raw))
+          end
+
+          # Replaces the entry for the given label.
+          #
+          # @return [Object] The new entry.
+          #
+          def []=(key, value)
+            @raw_entries.delete(key)
+            @entries[key] = value
+          end
+
+          # @return [Boolean] Whether there is an entry for the given label.
+          #
+          def key?(key)
+            @raw_entries.key?(key) || @entries.key?(key)
+          end
+          alias_method :include?, :key?
+
+          # @return [Array<String>] The labels of all the entries.
+          #
+          def keys
+            @raw_entries.keys | @entries.keys
+          end
+
+          # Yields every label and its decoded entry.
+          #
+          def each
+            return enum_for(:each) unless block_given?
+            keys.each { |key| yield key, self[key] }
+          end
+
+          # @return [Integer] The number of entries.
+          #
+          def size
+            keys.size
+          end
+
+          # @return [Boolean] Whether there is no entry.
+          #
+          def empty?
+            @raw_entries.empty? && @entries.empty?
+          end
+
+          # @return [Hash{String => Object}] All the entries, decoded.
+          #
+          def to_h
+            Hash[keys.map { |key| [key, self[key]] }]
+          end
+
+          def ==(other)
+            other.respond_to?(:to_h) && to_h == other.to_h
+          end
+
+          # Serializes the entries, reusing the serialized form of the ones which have not been replaced.
+          #
+          # @yield  [Object] the entry to convert to a plain hash before serializing it.
+          #
+          # @return [Hash{String => String}]
+          #
+          def serialize
+            Hash[keys.map do |key|
+              raw = @raw_entries[key]
+              [key, raw || Marshal.dump(yield(@entries[key]))]
+            end]
+          end
+        end
+      end
+    end
+  end
+end
@@ -1,6 +1,7 @@
 module Pod
   class Installer
     module ProjectCache
+      autoload :BinaryCacheFile,            'cocoapods/installer/project_cache/binary_cache_file'
       autoload :ProjectCacheAnalyzer,       'cocoapods/installer/project_cache/project_cache_analyzer'
       autoload :ProjectInstallationCache,   'cocoapods/installer/project_cache/project_installation_cache'
       autoload :ProjectMetadataCache,       'cocoapods/installer/project_cache/project_metadata_cache'
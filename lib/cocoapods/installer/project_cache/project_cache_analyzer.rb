@@ -84,8 +84,8 @@ module Pod
           # Bail out early since these properties affect all targets and their associate projects.
           if cache.build_configurations != build_configurations ||
               cache.project_object_version != project_object_version ||
-              YAMLHelper.convert(cache.podfile_plugins) != YAMLHelper.convert(podfile_plugins) ||
-              YAMLHelper.convert(cache.installation_options) != YAMLHelper.convert(installation_options)
+              plain_data(cache.podfile_plugins) != plain_data(podfile_plugins) ||
+              plain_data(cache.installation_options) != plain_data(installation_options)
             UI.message 'Ignoring project cache due to project configuration changes.'
             return full_install_results
           end
@@ -133,6 +133,20 @@ module Pod
 
         private
 
+        # @return [Object] The given value with every hash converted to a plain hash keyed by strings, so that values
+        #         loaded from the cache can be compared to the current ones without serializing either.
+        #
+        def plain_data(value)
+          case value
+          when Hash
+            Hash[value.map { |key, nested_value| [key.to_s, plain_data(nested_value)] }]
+          when Array
+            value.map { |nested_value| plain_data(nested_value) }
+          else
+            value
+          end
+        end
+
         def create_cache_key_mappings(target_by_label)
           Hash[target_by_label.map do |label, target|
             case target
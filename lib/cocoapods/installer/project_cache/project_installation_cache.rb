@@ -1,12 +1,13 @@
 module Pod
   class Installer
     module ProjectCache
-      # Represents the cache stored at Pods/.project/installation_cache
+      # Represents the cache stored at Pods/.project_cache/installation_cache
       #
       class ProjectInstallationCache
+        require 'cocoapods/installer/project_cache/binary_cache_file'
         require 'cocoapods/installer/project_cache/target_cache_key'
 
-        # @return [Hash{String => TargetCacheKey}]
+        # @return [Hash{String => TargetCacheKey}, BinaryCacheFile::LazyEntries]
         #         Stored hash of target cache key objects for every pod target.
         #
         attr_reader :cache_key_by_target_label
@@ -67,13 +68,44 @@ module Pod
           @installation_options = installation_options
         end
 
+        # Writes the cache to the given path in the binary format.
+        #
+        # @param [String, Pathname] path
+        #
+        # @return [void]
+        #
         def save_as(path)
-          Pathname(path).dirname.mkpath
-          Sandbox.update_changed_file(path, YAMLHelper.convert(to_hash))
+          entries = BinaryCacheFile.serialize_entries(cache_key_by_target_label, &:to_h)
+          BinaryCacheFile.write(path, header_hash, entries)
         end
 
+        # Loads the cache from the given path. Binary caches are decoded lazily, target by target, while caches
+        # written in the legacy YAML format are migrated transparently.
+        #
+        # @param [Sandbox] sandbox
+        # @param [String, Pathname] path
+        #
+        # @return [ProjectInstallationCache]
+        #
         def self.from_file(sandbox, path)
-          return ProjectInstallationCache.new unless File.exist?(path)
+          if BinaryCacheFile.binary?(path)
+            header, raw_entries = BinaryCacheFile.load(path)
+            return ProjectInstallationCache.new unless header
+            cache_key_by_target_label = BinaryCacheFile::LazyEntries.new(raw_entries) do |key_hash|
+              TargetCacheKey.from_cache_hash(sandbox, key_hash)
+            end
+            ProjectInstallationCache.new(cache_key_by_target_label, header['BUILD_CONFIGURATIONS'], header['OBJECT_VERSION'],
+                                         header['PLUGINS'], header['INSTALLATION_OPTIONS'])
+          elsif File.exist?(path)
+            from_yaml_file(sandbox, path)
+          elsif File.exist?(legacy_path = BinaryCacheFile.legacy_yaml_path(path))
+            from_yaml_file(sandbox, legacy_path)
+          else
+            ProjectInstallationCache.new
+          end
+        end
+
+        def self.from_yaml_file(sandbox, path)
           contents = YAMLHelper.load_file(path)
           cache_keys = contents.fetch('CACHE_KEYS', {})
           cache_key_by_target_label = Hash[cache_keys.map do |name, key_hash|
@@ -85,6 +117,7 @@ module Pod
           installation_options = contents['INSTALLATION_OPTIONS']
           ProjectInstallationCache.new(cache_key_by_target_label, build_configurations, project_object_version, podfile_plugins, installation_options)
         end
+        private_class_method :from_yaml_file
 
         def to_hash
           cache_key_contents = Hash[cache_key_by_target_label.map do |label, key|
@@ -97,6 +130,19 @@ module Pod
           contents['INSTALLATION_OPTIONS'] = installation_options if installation_options
           contents
         end
+
+        private
+
+        # @return [Hash] The values of the cache shared by every target, as plain data.
+        #
+        def header_hash
+          header = {}
+          header['BUILD_CONFIGURATIONS'] = build_configurations.to_hash if build_configurations
+          header['OBJECT_VERSION'] = project_object_version if project_object_version
+          header['PLUGINS'] = podfile_plugins.to_hash if podfile_plugins
+          header['INSTALLATION_OPTIONS'] = installation_options.to_hash if installation_options
+          header
+        end
       end
     end
   end
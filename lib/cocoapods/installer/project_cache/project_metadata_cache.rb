@@ -4,13 +4,14 @@ module Pod
       # Represents the metadata cache
       #
       class ProjectMetadataCache
+        require 'cocoapods/installer/project_cache/binary_cache_file'
         require 'cocoapods/installer/project_cache/target_metadata.rb'
 
         # @return [Sandbox] The sandbox where the Pods should be installed.
         #
         attr_reader :sandbox
 
-        # @return [Hash{String => TargetMetadata}]
+        # @return [Hash{String => TargetMetadata}, BinaryCacheFile::LazyEntries]
         #         Hash of string by target metadata.
         #
         attr_reader :target_label_by_metadata
@@ -31,14 +32,15 @@ module Pod
           end]
         end
 
-        # Rewrites the entire cache to the given path.
+        # Rewrites the entire cache to the given path in the binary format.
         #
         # @param [String] path
         #
         # @return [void]
         #
         def save_as(path)
-          Sandbox.update_changed_file(path, YAMLHelper.convert_hash(to_hash, nil))
+          entries = BinaryCacheFile.serialize_entries(target_label_by_metadata, &:to_hash)
+          BinaryCacheFile.write(path, {}, entries)
         end
 
         # Updates the metadata cache based on installation results.
@@ -61,12 +63,34 @@ module Pod
           end
         end
 
+        # Loads the cache from the given path. Binary caches are decoded lazily, target by target, while caches
+        # written in the legacy YAML format are migrated transparently.
+        #
+        # @param [Sandbox] sandbox
+        # @param [String, Pathname] path
+        #
+        # @return [ProjectMetadataCache]
+        #
         def self.from_file(sandbox, path)
-          return ProjectMetadataCache.new(sandbox) unless File.exist?(path)
+          if BinaryCacheFile.binary?(path)
+            _, raw_entries = BinaryCacheFile.load(path)
+            return ProjectMetadataCache.new(sandbox) unless raw_entries
+            ProjectMetadataCache.new(sandbox, BinaryCacheFile::LazyEntries.new(raw_entries) { |hash| TargetMetadata.from_hash(hash) })
+          elsif File.exist?(path)
+            from_yaml_file(sandbox, path)
+          elsif File.exist?(legacy_path = BinaryCacheFile.legacy_yaml_path(path))
+            from_yaml_file(sandbox, legacy_path)
+          else
+            ProjectMetadataCache.new(sandbox)
+          end
+        end
+
+        def self.from_yaml_file(sandbox, path)
           contents = YAMLHelper.load_file(path)
           target_by_label_metadata = Hash[contents.map { |target_label, hash| [target_label, TargetMetadata.from_hash(hash)] }]
           ProjectMetadataCache.new(sandbox, target_by_label_metadata)
         end
+        private_class_method :from_yaml_file
       end
     end
   end
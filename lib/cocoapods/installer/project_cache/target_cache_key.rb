@@ -130,13 +130,13 @@ module Pod
         def self.from_pod_target(sandbox, target_by_label, pod_target, is_local_pod: false, checkout_options: nil)
           build_settings = {}
           build_settings[pod_target.label.to_s] = Hash[pod_target.build_settings.map do |k, v|
-            [k, Digest::MD5.hexdigest(v.xcconfig.to_s)]
+            [k, v.xcconfig_digest]
           end]
           pod_target.test_spec_build_settings_by_config.each do |name, settings_by_config|
-            build_settings[name] = Hash[settings_by_config.map { |k, v| [k, Digest::MD5.hexdigest(v.xcconfig.to_s)] }]
+            build_settings[name] = Hash[settings_by_config.map { |k, v| [k, v.xcconfig_digest] }]
           end
           pod_target.app_spec_build_settings_by_config.each do |name, settings_by_config|
-            build_settings[name] = Hash[settings_by_config.map { |k, v| [k, Digest::MD5.hexdigest(v.xcconfig.to_s)] }]
+            build_settings[name] = Hash[settings_by_config.map { |k, v| [k, v.xcconfig_digest] }]
           end
 
           # find resources from upstream dependencies that will be named in the `{name}-resources.sh` script
@@ -160,7 +160,8 @@ module Pod
             'PROJECT_NAME' => pod_target.project_name,
           }
           if is_local_pod
-            relative_file_paths = pod_target.all_files.map { |f| f.relative_path_from(sandbox.root).to_s }
+            path_list = pod_target.file_accessors.first.path_list unless pod_target.file_accessors.empty?
+            relative_file_paths = pod_target.all_files.map { |f| -path_list.relative_path_from(f, sandbox.root).to_s }
             contents['FILES'] = relative_file_paths.sort_by(&:downcase)
           end
           contents['CHECKOUT_OPTIONS'] = checkout_options if checkout_options
@@ -180,7 +181,7 @@ module Pod
         def self.from_aggregate_target(sandbox, target_by_label, aggregate_target)
           build_settings = {}
           aggregate_target.user_build_configurations.keys.each do |configuration|
-            build_settings[configuration] = Digest::MD5.hexdigest(aggregate_target.build_settings(configuration).xcconfig.to_s)
+            build_settings[configuration] = aggregate_target.build_settings(configuration).xcconfig_digest
           end
 
           # find resources from upstream dependencies that will be named in the `{name}-resources.sh` script
@@ -59,12 +59,38 @@ module Pod
 
         def install_all_pod_targets(projects_by_pod_targets)
           UI.message '- Installing Pod Targets' do
-            projects_by_pod_targets.each_with_object({}) do |(project, pod_targets), target_installation_results|
-              target_installation_results.merge!(install_pod_targets(project, pod_targets))
+            if installation_options.parallel_pod_target_installation? && projects_by_pod_targets.size > 1
+              install_all_pod_targets_concurrently(projects_by_pod_targets)
+            else
+              projects_by_pod_targets.each_with_object({}) do |(project, pod_targets), target_installation_results|
+                target_installation_results.merge!(install_pod_targets(project, pod_targets))
+              end
             end
           end
         end
 
+        # Installs the pod targets of every project on a thread pool. Each project is a separate object graph which
+        # is only modified by the thread installing its targets, and the results are merged in the order of the
+        # projects. The projects are wired together afterwards, on this thread.
+        #
+        def install_all_pod_targets_concurrently(projects_by_pod_targets)
+          require 'concurrent/executor/fixed_thread_pool'
+          require 'concurrent/promises'
+
+          pool = Concurrent::FixedThreadPool.new(installation_options.parallel_pod_target_installation_thread_pool_size, :idletime => 300)
+          futures = projects_by_pod_targets.map do |project, pod_targets|
+            Concurrent::Promises.future_on(pool, project, pod_targets) { |p, targets| install_pod_targets(p, targets) }
+          end
+          futures.each_with_object({}) do |future, target_installation_results|
+            target_installation_results.merge!(future.value!)
+          end
+        ensure
+          if pool
+            pool.shutdown
+            pool.wait_for_termination
+          end
+        end
+
         def install_aggregate_targets_into_project(project, aggregate_targets)
           return {} unless project
           install_aggregate_targets(project, aggregate_targets)
@@ -4,6 +4,7 @@ module Pod
       # The {PodsProjectGenerator} handles generation of CocoaPods Xcode projects.
       #
       class PodsProjectGenerator
+        require 'cocoapods/installer/xcode/pods_project_generator/support_files_manifest'
         require 'cocoapods/installer/xcode/pods_project_generator/target_installer_helper'
         require 'cocoapods/installer/xcode/pods_project_generator/pod_target_integrator'
         require 'cocoapods/installer/xcode/pods_project_generator/target_installer'
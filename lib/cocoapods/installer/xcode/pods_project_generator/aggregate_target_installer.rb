@@ -40,6 +40,7 @@ module Pod
               create_acknowledgements
               create_dummy_source(native_target)
               clean_support_files_temp_dir
+              save_support_files_manifest
               TargetInstallationResult.new(target, native_target)
             end
           end
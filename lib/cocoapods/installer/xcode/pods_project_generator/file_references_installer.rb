@@ -64,6 +64,8 @@ module Pod
           #
           # @note   The contents of the file accessors are modified by the clean
           #         step of the #{PodSourceInstaller} and by the pre install hooks.
+          #         Path lists with a snapshot belong to Pods which have not
+          #         been installed again and are not refreshed.
           #
           # @return [void]
           #
@@ -71,7 +73,7 @@ module Pod
             file_accessors.reject do |file_accessor|
               pod_name = file_accessor.spec.name
               sandbox.local?(pod_name)
-            end.map(&:path_list).uniq.each(&:read_file_system)
+            end.map(&:path_list).uniq.reject(&:snapshot).each(&:read_file_system)
           end
 
           # Prepares the main groups to which all files will be added for the respective target
@@ -181,6 +183,11 @@ module Pod
                   end
                 end
               end
+
+              pod_targets.each do |pod_target|
+                pod_target.build_headers.finish_reconciliation!(pod_target.headers_sandbox)
+                sandbox.public_headers.finish_reconciliation!(pod_target.headers_sandbox)
+              end
             end
           end
 
@@ -137,6 +137,7 @@ module Pod
               create_dummy_source(native_target) if target.should_build?
               create_copy_dsyms_script
               clean_support_files_temp_dir
+              save_support_files_manifest
               TargetInstallationResult.new(target, native_target, resource_bundle_targets,
                                            test_native_targets, test_resource_bundle_targets, test_app_host_targets,
                                            app_native_targets, app_resource_bundle_targets)
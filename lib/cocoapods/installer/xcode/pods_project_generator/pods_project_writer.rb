@@ -42,11 +42,11 @@ module Pod
         def write!
           cleanup_projects(projects)
 
+          library_product_types = [:framework, :dynamic_library, :static_library]
+          results_by_native_target = Hash[pod_target_installation_results.map do |_, result|
+            [result.native_target, result]
+          end]
           projects.each do |project|
-            library_product_types = [:framework, :dynamic_library, :static_library]
-            results_by_native_target = Hash[pod_target_installation_results.map do |_, result|
-              [result.native_target, result]
-            end]
             project.recreate_user_schemes(false) do |scheme, target|
               next unless target.respond_to?(:symbol_type)
               next unless library_product_types.include? target.symbol_type
@@ -76,12 +76,74 @@ module Pod
 
         # Sorts and then saves projects which writes them to disk.
         #
+        # @note   When `parallel_project_writing` is enabled the projects are
+        #         sorted in this process, so that the in-memory projects stay
+        #         identical to the ones on disk, and serialized by forked
+        #         worker processes.
+        #
         def save_projects(projects)
-          projects.each do |project|
-            project.sort(:groups_position => :below)
-            UI.message "- Writing Xcode project file to #{UI.path project.path}" do
-              project.save
+          process_count = [installation_options.parallel_project_writing_process_count, projects.count].min
+          if installation_options.parallel_project_writing? && process_count > 1 && Process.respond_to?(:fork)
+            projects.each do |project|
+              project.sort(:groups_position => :below)
+              UI.message "- Writing Xcode project file to #{UI.path project.path}"
             end
+            save_projects_in_processes(projects, process_count)
+          else
+            projects.each do |project|
+              project.sort(:groups_position => :below)
+              UI.message "- Writing Xcode project file to #{UI.path project.path}" do
+                project.save
+              end
+            end
+          end
+        end
+
+        # Saves the given projects spread across the given number of forked
+        # processes.
+        #
+        # @param  [Array<Project>] projects
+        #         The projects to save.
+        #
+        # @param  [Integer] process_count
+        #         The number of processes to fork.
+        #
+        # @raise  [Informative] If any of the projects could not be saved.
+        #
+        # @return [void]
+        #
+        def save_projects_in_processes(projects, process_count)
+          slices = projects.each_with_index.group_by { |_, index| index % process_count }.values
+          $stdout.flush
+          $stderr.flush
+          workers = slices.map do |slice|
+            reader, writer = IO.pipe
+            pid = Process.fork do
+              reader.close
+              begin
+                slice.each { |project, _| project.save }
+                writer.close
+                exit!(0)
+              rescue StandardError => e
+                writer.write("#{e.class}: #{e.message}")
+                writer.close
+                exit!(1)
+              end
+            end
+            writer.close
+            [pid, reader]
+          end
+
+          errors = workers.map do |pid, reader|
+            message = reader.read
+            reader.close
+            _, status = Process.wait2(pid)
+            next if status.success?
+            message.empty? ? "Worker exited with status #{status.exitstatus}" : message
+          end.compact
+
+          unless errors.empty?
+            raise Informative, "Failed to write the Xcode projects:\n#{errors.join("\n")}"
           end
         end
       end
@@ -0,0 +1,137 @@
+require 'digest'
+require 'json'
+
+module Pod
+  class Installer
+    class Xcode
+      class PodsProjectGenerator
+        # Records, for every support file of a target, the digest of the inputs
+        # of its generator and of its contents, along with the size and the
+        # modification time of the file once written.
+        #
+        # Generators whose inputs did not change since the last installation
+        # are not run again, and the contents of the others are compared with
+        # the recorded digest instead of the file, as long as the file was not
+        # modified since it was written.
+        #
+        class SupportFilesManifest
+          # @return [Integer] The version of the format of the manifest.
+          #         Manifests saved with a different version are ignored.
+          #
+          FORMAT_VERSION = 1
+
+          # @return [String] The name of the manifest file in the support
+          #         files directory of a target.
+          #
+          FILE_NAME = '.support_files_manifest.json'.freeze
+
+          # @return [Pathname] The path of the manifest file.
+          #
+          attr_reader :path
+
+          # Initialize a new instance
+          #
+          # @param  [Pathname] path @see #path
+          #
+          def initialize(path)
+            @path = path
+            @entries = load_entries
+            @updated_entries = {}
+          end
+
+          # Updates the given support file, unless the manifest shows that it
+          # is already up to date.
+          #
+          # @param  [#generate] generator
+          #         the generator of the contents of the file.
+          #
+          # @param  [Pathname] file_path
+          #         the path of the file.
+          #
+          # @yield  Writes the file if its contents changed.
+          #
+          # @return [Boolean] Whether the file had to be updated.
+          #
+          def update_file(generator, file_path)
+            key = file_path.relative_path_from(path.dirname).to_s
+            entry = @entries[key]
+            inputs = inputs_digest(generator)
+            up_to_date = entry && unchanged_on_disk?(file_path, entry)
+
+            if up_to_date && inputs && entry['inputs'] == inputs
+              @updated_entries[key] = entry
+              return false
+            end
+
+            output = output_digest(generator)
+            if up_to_date && entry['output'] == output
+              @updated_entries[key] = entry.merge('inputs' => inputs)
+              return false
+            end
+
+            yield
+            if file_path.file?
+              stat = file_path.stat
+              @updated_entries[key] = { 'inputs' => inputs, 'output' => output, 'size' => stat.size, 'mtime' => stat.mtime.to_f }
+            end
+            true
+          end
+
+          # Saves the entries of the files updated since the manifest was
+          # loaded, dropping the entries of the files which are not generated
+          # anymore.
+          #
+          # @return [void]
+          #
+          def save
+            return if @updated_entries == @entries
+            path.dirname.mkpath
+            temp_path = "#{path}.#{Process.pid}.tmp"
+            File.write(temp_path, JSON.generate('version' => FORMAT_VERSION, 'files' => @updated_entries))
+            File.rename(temp_path, path)
+          end
+
+          private
+
+          def load_entries
+            return {} unless path.file?
+            manifest = JSON.parse(path.read)
+            return {} unless manifest['version'] == FORMAT_VERSION
+            manifest['files'] || {}
+          rescue JSON::ParserError
+            {}
+          end
+
+          # @return [String, Nil] The digest of the inputs of the given
+          #         generator, if it declares them.
+          #
+          def inputs_digest(generator)
+            return unless generator.respond_to?(:digest_inputs)
+            Digest::SHA256.hexdigest([Pod::VERSION, generator.class.name, generator.digest_inputs].to_json)
+          end
+
+          # @return [String] The digest of the contents rendered by the given
+          #         generator, streamed into the digest when the generator
+          #         supports it.
+          #
+          def output_digest(generator)
+            digest = Digest::SHA256.new
+            if generator.respond_to?(:write_to)
+              generator.write_to(digest)
+            else
+              digest << generator.generate.to_s
+            end
+            digest.hexdigest
+          end
+
+          def unchanged_on_disk?(file_path, entry)
+            stat = file_path.stat
+            stat.size == entry['size'] && stat.mtime.to_f == entry['mtime']
+          rescue SystemCallError
+            false
+          end
+        end
+      end
+    end
+  end
+end
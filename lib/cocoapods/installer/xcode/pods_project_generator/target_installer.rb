@@ -112,7 +112,31 @@ module Pod
           # Remove temp file whose store .prefix/config/dummy file.
           #
           def clean_support_files_temp_dir
-            support_files_temp_dir.rmtree if support_files_temp_dir.exist?
+            FileUtils.rm_rf(support_files_temp_dir)
+          end
+
+          # @return [SupportFilesManifest] The manifest of the support files
+          #         generated for the target.
+          #
+          def support_files_manifest
+            @support_files_manifest ||= SupportFilesManifest.new(target.support_files_dir + SupportFilesManifest::FILE_NAME)
+          end
+
+          # Saves the manifest of the support files generated for the target.
+          #
+          # @return [void]
+          #
+          def save_support_files_manifest
+            support_files_manifest.save
+          end
+
+          # Saves the content of a support file of the target unless the
+          # manifest of the support files shows that it is up to date.
+          #
+          # @see TargetInstallerHelper#update_changed_file
+          #
+          def update_changed_file(generator, path)
+            super(generator, path, support_files_manifest)
           end
 
           # @return [String] The temp file path to store temporary files.
@@ -9,10 +9,18 @@ module Pod
           # @param [Pathname] path
           #        the pathname to save the content into.
           #
+          # @param [SupportFilesManifest] manifest
+          #        the manifest of the support files of the target, used to skip the generation or the comparison
+          #        of the content when it shows that the file is up to date.
+          #
           # Saves the content the provided path unless the path exists and the contents are exactly the same.
           #
-          def update_changed_file(generator, path)
-            if path.exist?
+          def update_changed_file(generator, path, manifest = nil)
+            if manifest
+              manifest.update_file(generator, path) { TargetInstallerHelper.update_changed_file(generator, path) }
+            elsif path.exist? && generator.respond_to?(:write_to)
+              Generator::ChangedFileWriter.open(path) { |file| generator.write_to(file) }
+            elsif path.exist?
               contents = generator.generate.to_s
               content_stream = StringIO.new(contents)
               identical = File.open(path, 'rb') { |f| FileUtils.compare_stream(f, content_stream) }
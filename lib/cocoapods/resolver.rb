@@ -68,6 +68,7 @@ module Pod
       @cached_sets = {}
       @podfile_requirements_by_root_name = @podfile_dependency_cache.podfile_dependencies.group_by(&:root_name).each_value { |a| a.map!(&:requirement).freeze }.freeze
       @search = {}
+      @dependencies_by_specification = {}.compare_by_identity
       @validated_platforms = Set.new
     end
 
@@ -173,13 +174,18 @@ module Pod
     # @param  [Specification] specification the specification whose own
     #         dependencies are being asked for.
     #
+    # @note  The dependencies are computed once per specification, since the
+    #        resolver asks for them every time it considers a possibility.
+    #
     def dependencies_for(specification)
-      root_name = Specification.root_name(specification.name)
-      specification.all_dependencies.map do |dependency|
-        if dependency.root_name == root_name
-          dependency.dup.tap { |d| d.specific_version = specification.version }
-        else
-          dependency
+      @dependencies_by_specification[specification] ||= begin
+        root_name = Specification.root_name(specification.name)
+        specification.all_dependencies.map do |dependency|
+          if dependency.root_name == root_name
+            dependency.dup.tap { |d| d.specific_version = specification.version }
+          else
+            dependency
+          end
         end
       end
     end
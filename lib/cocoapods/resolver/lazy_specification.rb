@@ -19,18 +19,23 @@ module Pod
           @name = name
           @version = version
           @spec_source = spec_source
+          @subspecs_by_name = {}
         end
 
+        # Returns the same object for every lookup of a given subspec, so that
+        # the specification is only loaded and searched once per resolution.
+        #
         def subspec_by_name(name = nil, raise_if_missing = true, include_non_library_specifications = false)
+          key = [name, raise_if_missing, include_non_library_specifications]
+          return @subspecs_by_name[key] if @subspecs_by_name.key?(key)
+
           subspec =
             if !name || name == self.name
               self
             else
               specification.subspec_by_name(name, raise_if_missing, include_non_library_specifications)
             end
-          return unless subspec
-
-          SpecWithSource.new subspec, spec_source
+          @subspecs_by_name[key] = subspec && SpecWithSource.new(subspec, spec_source)
         end
 
         def specification
@@ -52,6 +57,11 @@ module Pod
       end
 
       # returns the highest versioned spec last
+      #
+      # The lazy specifications are shared by all the requirements, so that
+      # each version is loaded at most once however many requirements it
+      # satisfies.
+      #
       def all_specifications(warn_for_multiple_pod_sources, requirement)
         @all_specifications ||= {}
         @all_specifications[requirement] ||= begin
@@ -79,10 +89,17 @@ module Pod
           sources_by_version.sort_by(&:first).flat_map do |version, sources|
             # within each version, we want the prefered (first-specified) source
             # to be the _last_ one
-            sources.reverse_each.map { |source| LazySpecification.new(name, version, source) }
+            sources.reverse_each.map { |source| lazy_specification(version, source) }
           end
         end
       end
+
+      private
+
+      def lazy_specification(version, source)
+        @lazy_specifications ||= {}
+        @lazy_specifications[[version, source]] ||= LazySpecification.new(name, version, source)
+      end
     end
   end
 end
@@ -44,11 +44,12 @@ module Pod
   #
   #
   class Sandbox
-    autoload :FileAccessor,  'cocoapods/sandbox/file_accessor'
-    autoload :HeadersStore,  'cocoapods/sandbox/headers_store'
-    autoload :PathList,      'cocoapods/sandbox/path_list'
-    autoload :PodDirCleaner, 'cocoapods/sandbox/pod_dir_cleaner'
-    autoload :PodspecFinder, 'cocoapods/sandbox/podspec_finder'
+    autoload :FileAccessor,     'cocoapods/sandbox/file_accessor'
+    autoload :HeadersStore,     'cocoapods/sandbox/headers_store'
+    autoload :PathList,         'cocoapods/sandbox/path_list'
+    autoload :PathListSnapshot, 'cocoapods/sandbox/path_list_snapshot'
+    autoload :PodDirCleaner,    'cocoapods/sandbox/pod_dir_cleaner'
+    autoload :PodspecFinder,    'cocoapods/sandbox/podspec_finder'
 
     # @return [Pathname] the root of the sandbox.
     #
@@ -58,6 +59,13 @@ module Pod
     #
     attr_reader :public_headers
 
+    # @return [Hash{String => Hash{String => String, Symbol}}] the entries of
+    #         the header directories being reconciled, keyed by the absolute
+    #         path of the directories. They are shared by all the header
+    #         stores, since the variants of a Pod share their directories.
+    #
+    attr_reader :reconciled_header_entries
+
     # Initialize a new instance
     #
     # @param [String, Pathname] root @see #root
@@ -66,6 +74,7 @@ module Pod
       FileUtils.mkdir_p(root)
       @root = Pathname.new(root).realpath
       @public_headers = HeadersStore.new(self, 'Public', :public)
+      @reconciled_header_entries = {}
       @predownloaded_pods = []
       @downloaded_pods = []
       @checkout_sources = {}
@@ -96,6 +105,7 @@ module Pod
       podspec_path.rmtree if podspec_path&.exist?
       pod_target_project_path = pod_target_project_path(name)
       pod_target_project_path.rmtree if pod_target_project_path&.exist?
+      FileUtils.rm_f(path_list_snapshot_path(name))
     end
 
     # Prepares the sandbox for a new installation removing any file that will
@@ -135,13 +145,13 @@ module Pod
     # @return [Pathname] the path of the installation cache.
     #
     def project_installation_cache_path
-      root.join('.project_cache', 'installation_cache.yaml')
+      root.join('.project_cache', 'installation_cache')
     end
 
     # @return [Pathname] the path of the metadata cache.
     #
     def project_metadata_cache_path
-      root.join('.project_cache', 'metadata_cache.yaml')
+      root.join('.project_cache', 'metadata_cache')
     end
 
     # @return [Pathname] the path of the version cache.
@@ -150,6 +160,35 @@ module Pod
       root.join('.project_cache', 'version')
     end
 
+    # @return [Pathname] the path of the cache of the analysis of the vendored
+    #         binaries and XCFrameworks.
+    #
+    def binary_metadata_cache_path
+      root.join('.project_cache', 'binary_metadata')
+    end
+
+    # @return [Pathname] the path of the cache of the dependency resolution.
+    #
+    def resolution_cache_path
+      root.join('.project_cache', 'resolution')
+    end
+
+    # @return [Pathname] the directory where the snapshots of the file listings
+    #         of the Pods are stored.
+    #
+    def path_list_snapshots_root
+      root + '.path_list_snapshots'
+    end
+
+    # @param  [String] name
+    #         The name of the Pod.
+    #
+    # @return [Pathname] the path of the snapshot of the file listing of a Pod.
+    #
+    def path_list_snapshot_path(name)
+      path_list_snapshots_root + Specification.root_name(name)
+    end
+
     # @param [String] pod_target_name
     # Name of the pod target used to generate the path of its Xcode project.
     #
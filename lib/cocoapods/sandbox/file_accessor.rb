@@ -519,11 +519,12 @@ module Pod
       #
       # @raise  [Informative] If the pod does not exists.
       #
-      # @return [Array<Pathname>] A list of the paths.
+      # @return [Array<Pathname>] A list of the paths, shared with the other
+      #         file accessors of the Pod and frozen.
       #
       def expanded_paths(patterns, options = {})
         return [] if patterns.empty?
-        path_list.glob(patterns, options).flatten.compact.uniq
+        path_list.glob(patterns, options)
       end
 
       #-----------------------------------------------------------------------#
@@ -88,6 +88,55 @@ module Pod
         path.rmtree if path.exist?
       end
 
+      # Starts reconciling the directory at the given path relative to the
+      # root with the headers which are added to it, as a replacement for
+      # {#implode_path!}.
+      #
+      # The existing tree is read once, even if the directory is shared by
+      # several stores, such as the ones of the variants of a Pod. The
+      # symlinks which are added again with the same source by any of them are
+      # left untouched, and the entries which are not added again are removed
+      # by {#finish_reconciliation!}.
+      #
+      # @param [Pathname] path
+      #        The path used to join with #root and reconcile.
+      #
+      # @return [void]
+      #
+      def reconcile_path!(path)
+        return implode_path!(path) if Gem.win_platform?
+        directory = root.join(path)
+        return if reconciled_entries.key?(directory.to_s)
+        entries = {}
+        if directory.directory?
+          Dir.glob("#{escape_glob(directory)}/**/*", File::FNM_DOTMATCH).each do |entry|
+            next if %w(. ..).include?(File.basename(entry))
+            entries[entry] = File.symlink?(entry) ? File.readlink(entry) : File.ftype(entry).to_sym
+          end
+          entries[directory.to_s] = :directory
+        end
+        reconciled_entries[directory.to_s] = entries
+      end
+
+      # Removes the entries of the directory at the given path relative to the
+      # root which have not been added since {#reconcile_path!} has been
+      # called, and the directories left empty. It must be called once every
+      # store sharing the directory has added its headers.
+      #
+      # @param [Pathname] path
+      #        The path used to join with #root.
+      #
+      # @return [void]
+      #
+      def finish_reconciliation!(path)
+        return unless entries = reconciled_entries.delete(root.join(path).to_s)
+        directories, stale_files = entries.keys.partition { |entry| entries[entry] == :directory }
+        stale_files.each { |entry| FileUtils.rm_f(entry) }
+        directories.sort_by { |entry| -entry.length }.each do |entry|
+          Dir.rmdir(entry) if File.directory?(entry) && Dir.empty?(entry)
+        end
+      end
+
       #-----------------------------------------------------------------------#
 
       public
@@ -109,7 +158,7 @@ module Pod
       # @return [Array<Pathname>]
       #
       def add_files(namespace, relative_header_paths)
-        root.join(namespace).mkpath unless relative_header_paths.empty?
+        root.join(namespace).mkpath unless relative_header_paths.empty? || reconciled_directory?(root.join(namespace))
         relative_header_paths.map do |relative_header_path|
           add_file(namespace, relative_header_path, :mkdir => false)
         end
@@ -131,16 +180,17 @@ module Pod
       #
       def add_file(namespace, relative_header_path, mkdir: true)
         namespaced_path = root + namespace
-        namespaced_path.mkpath if mkdir
+        namespaced_path.mkpath if mkdir && !reconciled_directory?(namespaced_path)
 
         absolute_source = (sandbox.root + relative_header_path)
         source = absolute_source.relative_path_from(namespaced_path)
+        link_path = namespaced_path + relative_header_path.basename
         if Gem.win_platform?
           FileUtils.ln(absolute_source, namespaced_path, :force => true)
-        else
+        elsif !reconciled_symlink?(link_path, source)
           FileUtils.ln_sf(source, namespaced_path)
         end
-        namespaced_path + relative_header_path.basename
+        link_path
       end
 
       # Adds an header search path to the sandbox.
@@ -158,6 +208,60 @@ module Pod
       end
 
       #-----------------------------------------------------------------------#
+
+      private
+
+      # @!group Private helpers
+
+      # @return [Hash{String => String, Symbol}] the entries of the reconciled
+      #         directory which contains the given path, if any.
+      #
+      def reconciled_entries_for(path)
+        return if reconciled_entries.empty?
+        prefix = root.to_s
+        return unless path.to_s.start_with?("#{prefix}/")
+        path.to_s[prefix.length + 1..-1].split('/').each do |component|
+          prefix = "#{prefix}/#{component}"
+          entries = reconciled_entries[prefix]
+          return entries if entries
+        end
+        nil
+      end
+
+      # @return [Hash{String => Hash{String => String, Symbol}}] the entries
+      #         of the directories being reconciled, shared through the
+      #         sandbox.
+      #
+      def reconciled_entries
+        sandbox.reconciled_header_entries
+      end
+
+      # @return [Boolean] whether the directory at the given path is known to
+      #         exist in a reconciled directory.
+      #
+      def reconciled_directory?(path)
+        entries = reconciled_entries_for(path)
+        !entries.nil? && entries[path.to_s] == :directory
+      end
+
+      # Marks the symlink at the given path as added, so that it is not
+      # removed by {#finish_reconciliation!} whether it is kept or linked
+      # again.
+      #
+      # @return [Boolean] whether the symlink exists in a reconciled
+      #         directory with the given source.
+      #
+      def reconciled_symlink?(path, source)
+        entries = reconciled_entries_for(path)
+        return false unless entries
+        entries.delete(path.to_s) == source.to_s
+      end
+
+      # @return [String] the given path with the glob metacharacters escaped.
+      #
+      def escape_glob(path)
+        path.to_s.gsub(/[\\\[\]*?{}]/) { |char| "\\#{char}" }
+      end
     end
   end
 end
@@ -18,21 +18,30 @@ module Pod
       #
       attr_reader :root
 
+      # @return [PathListSnapshot] The snapshot used to load the list of the
+      #         paths instead of reading the file system, if any.
+      #
+      attr_accessor :snapshot
+
       # Initialize a new instance
       #
       # @param  [Pathname] root @see #root
       #
       def initialize(root)
         root_dir = root.to_s.unicode_normalize(:nfkc)
-        @root = Pathname.new(root_dir)
+        @root = Pathname.new(root_dir).freeze
         @glob_cache = {}
+        @pattern_cache = {}
+        @relative_pathnames = {}
+        @absolute_pathnames = {}
+        @relative_paths_by_base = {}
       end
 
       # @return [Array<String>] The list of absolute the path of all the files
       #         contained in {root}.
       #
       def files
-        read_file_system unless @files
+        load_file_system unless @files
         @files
       end
 
@@ -40,10 +49,32 @@ module Pod
       #         directories contained in {root}.
       #
       def dirs
-        read_file_system unless @dirs
+        load_file_system unless @dirs
         @dirs
       end
 
+      # @return [Boolean] Whether the lists of the paths have been loaded from
+      #         the {snapshot} instead of the file system.
+      #
+      def loaded_from_snapshot?
+        @loaded_from_snapshot == true
+      end
+
+      # @return [void] Populates the files and paths lists from the
+      #         {snapshot} if it is valid, or from the file system otherwise.
+      #
+      def load_file_system
+        if snapshot && (listing = snapshot.load)
+          @files, @dirs = listing.map { |paths| paths.map { |path| -path } }
+          @glob_cache = {}
+          @pattern_cache = {}
+          @loaded_from_snapshot = true
+          build_index
+        else
+          read_file_system
+        end
+      end
+
       # @return [void] Reads the file system and populates the files and paths
       #         lists.
       #
@@ -63,7 +94,7 @@ module Pod
           f = f.slice(root_length, f.length - root_length)
           next if f.nil?
 
-          (directory ? dirs : files) << f
+          (directory ? dirs : files) << -f
         end
 
         dirs.sort_by!(&:upcase)
@@ -72,6 +103,9 @@ module Pod
         @dirs = dirs
         @files = files
         @glob_cache = {}
+        @pattern_cache = {}
+        @loaded_from_snapshot = false
+        build_index
       end
 
       #-----------------------------------------------------------------------#
@@ -92,7 +126,11 @@ module Pod
       #
       def glob(patterns, options = {})
         cache_key = options.merge(:patterns => patterns)
-        @glob_cache[cache_key] ||= relative_glob(patterns, options).map { |p| root.join(p) }
+        cached = @glob_cache[cache_key]
+        return cached if cached
+
+        paths = relative_glob(patterns, options).uniq.map { |p| absolute_pathname(p) }.freeze
+        @glob_cache[cache_key] = paths
       end
 
       # The list of relative paths that are case insensitively matched by a
@@ -123,34 +161,14 @@ module Pod
         exclude_patterns = options[:exclude_patterns]
         include_dirs = options[:include_dirs]
 
-        if include_dirs
-          full_list = files + dirs
-        else
-          full_list = files
-        end
         patterns_array = Array(patterns)
-        exact_matches = (full_list & patterns_array).to_set
 
         unless patterns_array.empty?
           list = patterns_array.flat_map do |pattern|
-            if exact_matches.include?(pattern)
-              pattern
-            else
-              if directory?(pattern) && dir_pattern
-                pattern += '/' unless pattern.end_with?('/')
-                pattern += dir_pattern
-              end
-              expanded_patterns = dir_glob_equivalent_patterns(pattern)
-              full_list.select do |path|
-                expanded_patterns.any? do |p|
-                  File.fnmatch(p, path, File::FNM_CASEFOLD | File::FNM_PATHNAME)
-                end
-              end
-            end
+            pattern_matches(pattern, dir_pattern, include_dirs)
           end
         end
 
-        list = list.map { |path| Pathname.new(path) }
         if exclude_patterns
           exclude_options = { :dir_pattern => '**/*', :include_dirs => include_dirs }
           list -= relative_glob(exclude_patterns, exclude_options)
@@ -160,10 +178,92 @@ module Pod
 
       #-----------------------------------------------------------------------#
 
+      # @!group Interned paths
+
+      # @param  [String, Pathname] path
+      #         A path relative to the root.
+      #
+      # @return [Pathname] The frozen relative pathname of the given path,
+      #         shared by all the globs which match it.
+      #
+      def relative_pathname(path)
+        @relative_pathnames[path.to_s] ||= Pathname.new(-path.to_s).freeze
+      end
+
+      # @param  [String, Pathname] path
+      #         A path relative to the root.
+      #
+      # @return [Pathname] The frozen absolute pathname of the given path,
+      #         shared by all the globs which match it.
+      #
+      def absolute_pathname(path)
+        @absolute_pathnames[path.to_s] ||= root.join(path).freeze
+      end
+
+      # Computes the path of a file relative to a directory only once, for
+      # the file lists and the header mappings which need it again for every
+      # target and configuration.
+      #
+      # @param  [Pathname] path
+      #         The path of a file of the list.
+      #
+      # @param  [Pathname] base
+      #         The directory the path should be relative to.
+      #
+      # @return [Pathname] The frozen relative path.
+      #
+      def relative_path_from(path, base)
+        paths = @relative_paths_by_base[base.to_s] ||= {}
+        paths[path.to_s] ||= path.relative_path_from(base).freeze
+      end
+
+      #-----------------------------------------------------------------------#
+
       private
 
       # @!group Private helpers
 
+      # Returns the paths matched by a single pattern. They are computed once
+      # and shared by all the globs which include the pattern, like the ones
+      # of the subspecs of a Pod, or of a subspec on several platforms, which
+      # often list the same source files or exclude files.
+      #
+      # @param  [String] pattern
+      #         A single {Dir#glob} like pattern.
+      #
+      # @param  [String, Nil] dir_pattern
+      #         @see #relative_glob
+      #
+      # @param  [Boolean] include_dirs
+      #         @see #relative_glob
+      #
+      # @return [Array<Pathname>]
+      #
+      def pattern_matches(pattern, dir_pattern, include_dirs)
+        include_dirs = include_dirs ? true : false
+        cache_key = [pattern, dir_pattern, include_dirs]
+        cached = @pattern_cache[cache_key]
+        return cached if cached
+
+        paths = if exact_match?(pattern, include_dirs)
+                  [pattern]
+                else
+                  if directory?(pattern) && dir_pattern
+                    pattern += '/' unless pattern.end_with?('/')
+                    pattern += dir_pattern
+                  end
+                  expanded_patterns = dir_glob_equivalent_patterns(pattern)
+                  candidates(expanded_patterns, include_dirs).select do |path|
+                    expanded_patterns.any? do |p|
+                      File.fnmatch(p, path, File::FNM_CASEFOLD | File::FNM_PATHNAME)
+                    end
+                  end
+                end
+        # Reading the file system while matching resets the cache, so it is
+        # only looked up once the paths are known.
+        @pattern_cache[cache_key] = paths.map { |path| relative_pathname(path) }.freeze
+      end
+
       # @return [Boolean] Wether a path is a directory. The result of this method
       #         computed without accessing the file system and is case
       #         insensitive.
@@ -172,7 +272,133 @@ module Pod
       #
       def directory?(sub_path)
         sub_path = sub_path.to_s.downcase.sub(/\/$/, '')
-        dirs.any? { |dir| dir.downcase == sub_path }
+        index[:downcased_dirs].include?(sub_path)
+      end
+
+      # @!group Index
+
+      # The characters which make a path component of a pattern match
+      # something else than its literal value.
+      #
+      GLOB_METACHARACTERS = /[*?\[\]{}\\]/
+
+      # @return [Hash] The index of the paths of the list, built once after
+      #         reading the file system.
+      #
+      def index
+        load_file_system unless @index
+        @index
+      end
+
+      # Builds the index used to restrict the paths matched against a pattern
+      # to the subtree of its literal prefix.
+      #
+      # The paths of the {files} and {dirs} lists are bucketed by the case
+      # folded path of each of their parent directories, keeping their
+      # original order. For example `Sources/Core/A.swift` is referenced by
+      # the `sources` and `sources/core` buckets.
+      #
+      # @note   Like {File::FNM_CASEFOLD}, only ASCII characters are case
+      #         folded.
+      #
+      # @return [void]
+      #
+      def build_index
+        @index = {
+          :file_set => @files.to_set,
+          :dir_set => @dirs.to_set,
+          :downcased_dirs => @dirs.map(&:downcase).to_set,
+          :file_buckets => buckets_by_parent_dir(@files),
+          :dir_buckets => buckets_by_parent_dir(@dirs),
+        }
+      end
+
+      # @param  [Array<String>] paths
+      #         The relative paths to bucket.
+      #
+      # @return [Hash{String => Array<Integer>}] The indexes of the given
+      #         paths, in ascending order, keyed by the case folded path of
+      #         each of their parent directories.
+      #
+      def buckets_by_parent_dir(paths)
+        buckets = Hash.new { |hash, key| hash[key] = [] }
+        paths.each_with_index do |path, index|
+          components = path.downcase(:ascii).split(File::SEPARATOR)
+          components.pop
+          prefix = nil
+          components.each do |component|
+            prefix = prefix ? "#{prefix}/#{component}" : component
+            buckets[prefix] << index
+          end
+        end
+        buckets.default_proc = nil
+        buckets
+      end
+
+      # @return [Boolean] Whether the given pattern is literally one of the
+      #         paths of the list.
+      #
+      # @param  [String] pattern
+      #         The pattern to look up.
+      #
+      # @param  [Boolean] include_dirs
+      #         Whether directories should be taken into account.
+      #
+      def exact_match?(pattern, include_dirs)
+        index[:file_set].include?(pattern) || (include_dirs && index[:dir_set].include?(pattern))
+      end
+
+      # Returns the paths which could be matched by any of the given
+      # {File.fnmatch} patterns, in the order of the {files} (followed by the
+      # {dirs}) list.
+      #
+      # As {File::FNM_PATHNAME} is used, the leading path components of a
+      # pattern without any glob metacharacter can only match the same case
+      # folded components. Only the subtree of that literal prefix is
+      # returned, or the whole list if any of the patterns does not have one.
+      #
+      # @param  [Array<String>] patterns
+      #         The {File.fnmatch} patterns which will be matched.
+      #
+      # @param  [Boolean] include_dirs
+      #         Whether directories should be returned.
+      #
+      # @return [Array<String>]
+      #
+      def candidates(patterns, include_dirs)
+        prefixes = patterns.map { |pattern| literal_prefix(pattern) }
+        if prefixes.include?(nil)
+          return include_dirs ? files + dirs : files
+        end
+
+        list = bucketed_paths(files, index[:file_buckets], prefixes)
+        list.concat(bucketed_paths(dirs, index[:dir_buckets], prefixes)) if include_dirs
+        list
+      end
+
+      # @return [Array<String>] The paths of the given list referenced by the
+      #         buckets of the given prefixes, in the order of the list.
+      #
+      def bucketed_paths(paths, buckets, prefixes)
+        indexes = prefixes.uniq.flat_map { |prefix| buckets.fetch(prefix, []) }
+        indexes.uniq! if prefixes.size > 1
+        indexes.sort!
+        paths.values_at(*indexes)
+      end
+
+      # @return [String, Nil] The case folded leading directories of the given
+      #         pattern which do not contain any glob metacharacter, or nil if
+      #         there are none.
+      #
+      # @param  [String] pattern
+      #         A {File.fnmatch} pattern.
+      #
+      def literal_prefix(pattern)
+        components = pattern.split(File::SEPARATOR, -1)
+        components.pop
+        literal_components = components.take_while { |component| component !~ GLOB_METACHARACTERS }
+        return if literal_components.empty?
+        literal_components.join(File::SEPARATOR).downcase(:ascii)
       end
 
       # @return [Array<String>] An array of patterns converted from a
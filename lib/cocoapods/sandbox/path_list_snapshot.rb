@@ -0,0 +1,109 @@
+require 'digest'
+
+module Pod
+  class Sandbox
+    # A serialized listing of the files and directories of a {PathList},
+    # stored in the sandbox so that the file system of a Pod whose contents
+    # did not change does not need to be walked again on the next
+    # installation.
+    #
+    # A snapshot is only valid for the key it has been saved with, which is
+    # derived from the checksum of the specification and the checkout options
+    # of the Pod stored in a lockfile.
+    #
+    class PathListSnapshot
+      # @return [Integer] The version of the serialization format. Snapshots
+      #         saved with a different version are ignored.
+      #
+      FORMAT_VERSION = 1
+
+      # @return [String] The separator of the serialized paths, which can
+      #         not be part of a path.
+      #
+      SEPARATOR = "\0".freeze
+
+      # @return [Pathname] The path of the file of the snapshot.
+      #
+      attr_reader :path
+
+      # @return [String] The key the snapshot is valid for.
+      #
+      attr_reader :key
+
+      # Initialize a new instance
+      #
+      # @param  [Pathname] path @see #path
+      # @param  [String] key @see #key
+      #
+      def initialize(path, key)
+        @path = path
+        @key = key
+      end
+
+      # Returns the key of the snapshot of the Pod with the given name for the
+      # given lockfile.
+      #
+      # @param  [Lockfile] lockfile
+      #         The lockfile which stores the checksum and the checkout
+      #         options of the Pod.
+      #
+      # @param  [String] pod_name
+      #         The name of the Pod.
+      #
+      # @return [String, Nil] The key, or nil if the lockfile does not store a
+      #         checksum for the Pod.
+      #
+      def self.key_for(lockfile, pod_name)
+        return unless lockfile
+        return unless checksum = lockfile.checksum(pod_name)
+        checkout_options = lockfile.checkout_options_for_pod_named(pod_name) || {}
+        checkout_options = checkout_options.map { |key, value| [key.to_s, value.to_s] }.sort
+        Digest::MD5.hexdigest([pod_name, checksum, checkout_options].inspect)
+      end
+
+      # Loads the listing stored in the snapshot.
+      #
+      # @return [Array<Array<String>>, Nil] The files and the directories of
+      #         the listing, or nil if the snapshot does not exist, can not be
+      #         read or has been saved for another key.
+      #
+      def load
+        return unless path.file?
+        version, stored_key, files, dirs = Marshal.load(File.binread(path))
+        return unless version == FORMAT_VERSION && stored_key == key
+        [files.split(SEPARATOR), dirs.split(SEPARATOR)]
+      rescue StandardError
+        nil
+      end
+
+      # @return [Boolean] Whether the snapshot exists and has been saved for
+      #         the {key}, without splitting its listing.
+      #
+      def valid?
+        return false unless path.file?
+        version, stored_key, = Marshal.load(File.binread(path))
+        version == FORMAT_VERSION && stored_key == key
+      rescue StandardError
+        false
+      end
+
+      # Stores the given listing in the snapshot.
+      #
+      # @param  [Array<String>] files
+      #         The files of the listing.
+      #
+      # @param  [Array<String>] dirs
+      #         The directories of the listing.
+      #
+      # @return [void]
+      #
+      def save(files, dirs)
+        path.dirname.mkpath
+        contents = Marshal.dump([FORMAT_VERSION, key, files.join(SEPARATOR), dirs.join(SEPARATOR)])
+        temp_path = "#{path}.#{Process.pid}.tmp"
+        File.binwrite(temp_path, contents)
+        File.rename(temp_path, path)
+      end
+    end
+  end
+end
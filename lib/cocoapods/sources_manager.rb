@@ -1,5 +1,6 @@
 require 'cocoapods-core/source'
 require 'cocoapods/open-uri'
+require 'cocoapods/sources_manager/search_index'
 require 'netrc'
 require 'set'
 require 'rest'
@@ -112,6 +113,79 @@ module Pod
         @search_index_path ||= Config.instance.search_index_file
       end
 
+      # @return [SearchIndex] The segmented search index, which is searched
+      #         instead of the search index file.
+      #
+      def segmented_search_index
+        @segmented_search_index ||= SearchIndex.new(Config.instance.search_index_dir)
+      end
+
+      alias_method :search_by_name_without_segments, :search_by_name
+
+      # Search the appropriate sources to match the set for the given name,
+      # reading the full text search index one segment at a time.
+      #
+      # @param  [String] query
+      #         the query to search for.
+      #
+      # @param  [Boolean] full_text_search
+      #         whether to search the authors, summaries and descriptions of
+      #         the Pods as well.
+      #
+      # @raise  If no set is found.
+      #
+      # @return [Array<Specification::Set>] The sets matching the query.
+      #
+      def search_by_name(query, full_text_search = false)
+        return search_by_name_without_segments(query) unless full_text_search
+        query_word_regexps = query.split.map { |word| /#{word}/i }
+        index_missing_sources
+        names = segmented_search_index.search(indexable_sources.map(&:name), query_word_regexps)
+        # The representative set is nil for the Pods which are not found in
+        # any of the sources anymore.
+        sets = names.map { |name| aggregate.representative_set(name) }.compact
+        if sets.empty?
+          raise Informative, 'Unable to find a pod with name, author, summary, ' \
+            "or description matching `#{query}`"
+        end
+        sorted_sets(sets, query_word_regexps)
+      end
+
+      # Creates the segmented search index of the sources which are not
+      # indexed yet, and saves the whole index to {#search_index_path} for
+      # the tools which read it.
+      #
+      # @return [Hash{String => Hash{String => Array<String>}}] The Pods of
+      #         every source keyed by the words of their specifications.
+      #
+      def updated_search_index
+        index_missing_sources
+        index = Hash[indexable_sources.map do |source|
+          [source.name, segmented_search_index.words_index(source.name)]
+        end]
+        save_search_index(index)
+        index
+      end
+
+      # Updates the segmented search index of the sources which are already
+      # indexed with the given changes, only rewriting the segments of the
+      # changed Pods.
+      #
+      # @param  [Hash{Source => Array<String>}] changed_spec_paths
+      #         the changed specification paths of every source.
+      #
+      # @return [void]
+      #
+      def update_search_index_if_needed(changed_spec_paths)
+        changed_spec_paths.each_pair do |source, spec_paths|
+          next unless source.indexable? && !spec_paths.empty?
+          next unless segmented_search_index.indexed?(source.name)
+          pods = source.pods_for_specification_paths(spec_paths)
+          changes = aggregate.generate_search_index_for_changes_in_source(source, spec_paths)
+          segmented_search_index.update(source.name, pods, words_by_pod(changes))
+        end
+      end
+
       # @!group Updating Sources
 
       # Updates the local clone of the spec-repo with the given name or of all
@@ -121,9 +195,15 @@ module Pod
       #
       # @param  [Boolean] show_output
       #
+      # @param  [Integer] jobs
+      #         the maximum number of sources updated concurrently. When more
+      #         than one source is updated at once, the output of the update
+      #         commands is not shown and each source is reported once all
+      #         of them are updated.
+      #
       # @return [void]
       #
-      def update(source_name = nil, show_output = false)
+      def update(source_name = nil, show_output = false, jobs: 1)
         if source_name
           sources = [updateable_source_named(source_name)]
         else
@@ -136,14 +216,20 @@ module Pod
         return unless repos_dir.exist?
 
         # Create the Spec_Lock file if needed and lock it so that concurrent
-        # repo updates do not cause each other to fail
+        # repo updates do not cause each other to fail. The lock is shared so
+        # that the updates of different sources can run concurrently, each
+        # source being locked on its own.
         File.open("#{repos_dir}/Spec_Lock", File::CREAT) do |f|
-          f.flock(File::LOCK_EX)
-          sources.each do |source|
-            UI.section "Updating spec repo `#{source.name}`" do
-              changed_source_paths = source.update(show_output)
-              changed_spec_paths[source] = changed_source_paths if changed_source_paths.count > 0
-              source.verify_compatibility!
+          f.flock(File::LOCK_SH)
+          if jobs > 1 && sources.count > 1
+            update_concurrently(sources, jobs, changed_spec_paths)
+          else
+            sources.each do |source|
+              UI.section "Updating spec repo `#{source.name}`" do
+                changed_source_paths = with_source_lock(source) { source.update(show_output) }
+                changed_spec_paths[source] = changed_source_paths if changed_source_paths.count > 0
+                source.verify_compatibility!
+              end
             end
           end
         end
@@ -158,6 +244,88 @@ module Pod
       def add_source(source)
         all << source unless all.any? { |s| s.url == source || s.name == source.name }
       end
+
+      private
+
+      # Creates the segmented search index of the sources which are not
+      # indexed yet.
+      #
+      # @return [void]
+      #
+      def index_missing_sources
+        indexable_sources.each do |source|
+          next if segmented_search_index.indexed?(source.name)
+          UI.print "Creating search index for spec repo '#{source.name}'.."
+          segmented_search_index.write(source.name, words_by_pod(aggregate.generate_search_index_for_source(source)))
+          UI.puts ' Done!'
+        end
+      end
+
+      # @param  [Hash{String => Array<String>}] index
+      #         the Pods keyed by the words of their specifications.
+      #
+      # @return [Hash{String => Array<String>}] The words of the
+      #         specifications keyed by Pod.
+      #
+      def words_by_pod(index)
+        index.each_with_object({}) do |(word, pods), words_by_pod|
+          pods.each { |pod| (words_by_pod[pod] ||= []) << word }
+        end
+      end
+
+      # Updates the given sources using a pool of threads, and reports them
+      # in order once they are all updated.
+      #
+      # @param  [Array<Source>] sources
+      #
+      # @param  [Integer] jobs
+      #         the number of threads.
+      #
+      # @param  [Hash{Source => Array<String>}] changed_spec_paths
+      #         the changed paths of every source, which are added to the hash.
+      #
+      # @return [void]
+      #
+      def update_concurrently(sources, jobs, changed_spec_paths)
+        require 'concurrent/executor/fixed_thread_pool'
+        require 'concurrent/promises'
+
+        pool = Concurrent::FixedThreadPool.new(jobs, :idletime => 300)
+        # The verbosity is set once for all the threads, since each update
+        # would otherwise change and restore it while the others are running.
+        futures = nil
+        Config.instance.with_changes(:verbose => false) do
+          futures = sources.map do |source|
+            Concurrent::Promises.future_on(pool, source) { |s| with_source_lock(s) { s.update(false) } }
+          end
+          futures.each(&:wait)
+        end
+        sources.zip(futures).each do |source, future|
+          UI.section "Updating spec repo `#{source.name}`" do
+            changed_source_paths = future.value!
+            changed_spec_paths[source] = changed_source_paths if changed_source_paths.count > 0
+            source.verify_compatibility!
+          end
+        end
+      ensure
+        if pool
+          pool.shutdown
+          pool.wait_for_termination
+        end
+      end
+
+      # Executes the given block while holding the lock of the given source.
+      #
+      # @param  [Source] source
+      #
+      # @return [Object] The value returned by the block.
+      #
+      def with_source_lock(source)
+        File.open("#{repos_dir}/.#{source.name}.lock", File::CREAT) do |f|
+          f.flock(File::LOCK_EX)
+          yield
+        end
+      end
     end
 
     extend Executable
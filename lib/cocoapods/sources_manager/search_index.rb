@@ -0,0 +1,188 @@
+require 'digest'
+require 'fileutils'
+require 'set'
+
+module Pod
+  class Source
+    class Manager
+      # A search index split in segments, which can be updated with just the
+      # Pods which changed and searched one line at a time instead of being
+      # loaded whole.
+      #
+      # The index of each source is a directory of {SEGMENT_COUNT} segments.
+      # Every Pod is stored in the segment picked by the digest of its name,
+      # on a line holding its name and the words of its specifications:
+      #
+      #     AFNetworking<TAB>a delightful framework ios macos networking
+      #
+      # Updating a Pod only rewrites the segment it is stored in.
+      #
+      class SearchIndex
+        # @return [Integer] The version of the format of the index. The index of
+        #         a source written with a different version is written again.
+        #
+        FORMAT_VERSION = 1
+
+        # @return [Integer] The number of segments of the index of a source.
+        #
+        SEGMENT_COUNT = 16
+
+        # @return [Pathname] The directory of the index.
+        #
+        attr_reader :root
+
+        # Initialize a new instance
+        #
+        # @param  [Pathname] root @see #root
+        #
+        def initialize(root)
+          @root = root
+        end
+
+        # @param  [String] source_name
+        #         the name of a source.
+        #
+        # @return [Boolean] Whether the index of the given source exists.
+        #
+        def indexed?(source_name)
+          version_file = source_root(source_name) + 'VERSION'
+          version_file.file? && version_file.read.strip == FORMAT_VERSION.to_s
+        end
+
+        # Writes the whole index of the given source.
+        #
+        # @param  [String] source_name
+        #         the name of the source.
+        #
+        # @param  [Hash{String => Array<String>}] words_by_pod
+        #         the words of the specifications of every Pod of the source.
+        #
+        # @return [void]
+        #
+        def write(source_name, words_by_pod)
+          FileUtils.rm_rf(source_root(source_name))
+          source_root(source_name).mkpath
+          entries_by_segment = words_by_pod.group_by { |pod, _| segment(pod) }
+          SEGMENT_COUNT.times do |segment|
+            write_segment(source_name, segment, Hash[entries_by_segment.fetch(segment, [])])
+          end
+          (source_root(source_name) + 'VERSION').open('w') { |f| f << FORMAT_VERSION.to_s }
+        end
+
+        # Replaces the entries of the given Pods in the index of the given
+        # source, rewriting only the segments they are stored in.
+        #
+        # @param  [String] source_name
+        #         the name of the source.
+        #
+        # @param  [Array<String>] pods
+        #         the names of the Pods which changed.
+        #
+        # @param  [Hash{String => Array<String>}] words_by_pod
+        #         the words of the specifications of the changed Pods. The
+        #         changed Pods which are missing are removed from the index.
+        #
+        # @return [void]
+        #
+        def update(source_name, pods, words_by_pod)
+          pods.group_by { |pod| segment(pod) }.each do |segment, segment_pods|
+            entries = read_segment(source_name, segment)
+            segment_pods.each do |pod|
+              if words_by_pod[pod]
+                entries[pod] = words_by_pod[pod]
+              else
+                entries.delete(pod)
+              end
+            end
+            write_segment(source_name, segment, entries)
+          end
+        end
+
+        # Searches the indexes of the given sources.
+        #
+        # @param  [Array<String>] source_names
+        #         the names of the sources to search.
+        #
+        # @param  [Array<Regexp>] query_word_regexps
+        #         the regular expressions which must all match a word of the
+        #         specifications of a Pod, in any of the sources.
+        #
+        # @return [Array<String>] The names of the matching Pods.
+        #
+        def search(source_names, query_word_regexps)
+          pods_by_regexp = Hash[query_word_regexps.map { |regexp| [regexp, Set.new] }]
+          source_names.each do |source_name|
+            each_entry(source_name) do |pod, words|
+              query_word_regexps.each do |regexp|
+                pods_by_regexp[regexp] << pod if words.any? { |word| word =~ regexp }
+              end
+            end
+          end
+          pods_by_regexp.values.reduce(:&).to_a
+        end
+
+        # @param  [String] source_name
+        #         the name of a source.
+        #
+        # @return [Hash{String => Array<String>}] The Pods of the given source
+        #         keyed by the words of their specifications, as in the search
+        #         index file.
+        #
+        def words_index(source_name)
+          index = {}
+          each_entry(source_name) do |pod, words|
+            words.each { |word| (index[word] ||= []) << pod }
+          end
+          index
+        end
+
+        private
+
+        # Yields the name and the words of every Pod of the given source.
+        #
+        def each_entry(source_name)
+          SEGMENT_COUNT.times do |segment|
+            path = segment_path(source_name, segment)
+            next unless path.file?
+            path.each_line do |line|
+              pod, words = line.chomp.split("\t", 2)
+              yield pod, words.to_s.split(' ')
+            end
+          end
+        end
+
+        def read_segment(source_name, segment)
+          entries = {}
+          path = segment_path(source_name, segment)
+          return entries unless path.file?
+          path.each_line do |line|
+            pod, words = line.chomp.split("\t", 2)
+            entries[pod] = words.to_s.split(' ')
+          end
+          entries
+        end
+
+        def write_segment(source_name, segment, entries)
+          path = segment_path(source_name, segment)
+          temp_path = "#{path}.#{Process.pid}.tmp"
+          File.open(temp_path, 'w') do |file|
+            entries.sort_by(&:first).each { |pod, words| file.puts("#{pod}\t#{words.join(' ')}") }
+          end
+          File.rename(temp_path, path)
+        end
+
+        def source_root(source_name)
+          root + source_name
+        end
+
+        def segment_path(source_name, segment)
+          source_root(source_name) + format('%02x.idx', segment)
+        end
+
+        def segment(pod)
+          Digest::MD5.hexdigest(pod)[0, 2].to_i(16) % SEGMENT_COUNT
+        end
+      end
+    end
+  end
+end
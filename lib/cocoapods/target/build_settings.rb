@@ -1,5 +1,7 @@
 # frozen_string_literal: true
 
+require 'digest'
+
 module Pod
   class Target
     # @since 1.5.0
@@ -192,6 +194,23 @@ module Pod
 
       alias generate xcconfig
 
+      # @return [String]
+      #   A digest of the {#xcconfig}, computed incrementally from its includes, attributes and linker flags instead
+      #   of its rendered contents. Like the rendered contents, it does not depend on the order of the keys and of the
+      #   linker flags.
+      #
+      define_build_settings_method :xcconfig_digest, :memoized => true do
+        config = xcconfig
+        digest = Digest::MD5.new
+        config.includes.each { |path| digest << 'include' << "\0" << path.to_s << "\0" }
+        config.attributes.sort_by(&:first).each { |key, value| digest << key.to_s << "\0" << value.to_s << "\0" }
+        config.other_linker_flags.sort_by { |key, _| key.to_s }.each do |key, values|
+          digest << key.to_s << "\0"
+          values.map(&:to_s).sort.each { |value| digest << value << "\0" }
+        end
+        digest.hexdigest
+      end
+
       # Saves the generated xcconfig to the given path
       #
       # @return [Xcodeproj::Config]
@@ -1130,6 +1130,7 @@ module Pod
     def header_mappings(file_accessor, headers)
       consumer = file_accessor.spec_consumer
       header_mappings_dir = consumer.header_mappings_dir
+      header_mappings_dir &&= file_accessor.path_list.root + header_mappings_dir
       dir = headers_sandbox
       dir += consumer.header_dir if consumer.header_dir
 
@@ -1139,7 +1140,7 @@ module Pod
 
         sub_dir = dir
         if header_mappings_dir
-          relative_path = header.relative_path_from(file_accessor.path_list.root + header_mappings_dir)
+          relative_path = file_accessor.path_list.relative_path_from(header, header_mappings_dir)
           sub_dir += relative_path.dirname
         end
         mappings[sub_dir] ||= []
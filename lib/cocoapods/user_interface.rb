@@ -1,5 +1,6 @@
 require 'cocoapods/user_interface/error_report'
 require 'cocoapods/user_interface/inspector_reporter'
+require 'cocoapods/user_interface/timings'
 
 module Pod
   # Provides support for UI output. It provides support for nested sections of
@@ -31,6 +32,11 @@ module Pod
       attr_accessor :disable_wrap
       alias_method :disable_wrap?, :disable_wrap
 
+      # @return [Timings] The recorder of the time spent in each section, if
+      #         timings have been requested.
+      #
+      attr_accessor :timings
+
       # Prints a title taking an optional verbose prefix and
       # a relative indentation valid for the UI action in the passed
       # block.
@@ -61,7 +67,7 @@ module Pod
 
         self.indentation_level += relative_indentation
         self.title_level += 1
-        yield if block_given?
+        measure(title) { yield } if block_given?
       ensure
         self.indentation_level -= relative_indentation
         self.title_level -= 1
@@ -83,7 +89,7 @@ module Pod
 
         self.indentation_level += relative_indentation
         self.title_level += 1
-        yield if block_given?
+        measure(title) { yield } if block_given?
       ensure
         self.indentation_level -= relative_indentation
         self.title_level -= 1
@@ -102,6 +108,7 @@ module Pod
       #        when the message is printed.
       #
       def title(title, verbose_prefix = '', relative_indentation = 2)
+        name = title
         if @treat_titles_as_messages
           message(title, verbose_prefix)
         else
@@ -115,7 +122,7 @@ module Pod
 
         self.indentation_level += relative_indentation
         self.title_level += 1
-        yield if block_given?
+        measure(name) { yield } if block_given?
       ensure
         self.indentation_level -= relative_indentation
         self.title_level -= 1
@@ -142,11 +149,12 @@ module Pod
       # @return [void]
       #
       def message(message, verbose_prefix = '', relative_indentation = 2)
+        name = message
         message = verbose_prefix + message if config.verbose?
         puts_indented message if config.verbose?
 
         self.indentation_level += relative_indentation
-        yield if block_given?
+        measure(name) { yield } if block_given?
       ensure
         self.indentation_level -= relative_indentation
       end
@@ -396,6 +404,22 @@ module Pod
 
       private
 
+      # Yields, recording the time spent in the given section if timings have
+      # been requested.
+      #
+      # @param  [String] name
+      #         The name of the section.
+      #
+      # @return [Object] The value returned by the block.
+      #
+      def measure(name)
+        if timings
+          timings.measure(name) { yield }
+        else
+          yield
+        end
+      end
+
       # @!group Helpers
       #-----------------------------------------------------------------------#
 
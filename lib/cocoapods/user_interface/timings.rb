@@ -0,0 +1,110 @@
+require 'json'
+
+module Pod
+  module UserInterface
+    # Records how long each section of the user interface takes, along with
+    # the objects allocated and the garbage collections run meanwhile, and
+    # writes them as a trace in the Chrome trace event format which can be
+    # loaded in `chrome://tracing` or compared across runs.
+    #
+    class Timings
+      # @return [Regexp] The regular expression matching the ANSI escape
+      #         sequences used to color the titles of the sections.
+      #
+      ANSI_ESCAPE = /\e\[[\d;]*m/
+
+      # @return [Array<Hash>] The events recorded so far, in the Chrome trace
+      #         event format.
+      #
+      attr_reader :events
+
+      # Initialize a new instance
+      #
+      def initialize
+        @events = []
+        @thread_ids = {}
+        @mutex = Mutex.new
+        @start_time = clock_time
+      end
+
+      # Measures the given block.
+      #
+      # @param  [String] name
+      #         The name of the measured section.
+      #
+      # @param  [String] category
+      #         The category of the measured section.
+      #
+      # @return [Object] The value returned by the block.
+      #
+      def measure(name, category = 'section')
+        start_time = clock_time
+        start_stats = gc_stats
+        yield
+      ensure
+        end_stats = gc_stats
+        event = {
+          'name' => name.to_s.gsub(ANSI_ESCAPE, '').strip,
+          'cat' => category,
+          'ph' => 'X',
+          'ts' => start_time - @start_time,
+          'dur' => clock_time - start_time,
+          'pid' => Process.pid,
+          'args' => Hash[end_stats.map { |key, value| [key, value - start_stats[key]] }],
+        }
+        @mutex.synchronize do
+          event['tid'] = @thread_ids[Thread.current] ||= @thread_ids.size + 1
+          @events << event
+        end
+      end
+
+      # @return [Hash] The recorded events, as a Chrome trace.
+      #
+      def to_trace
+        {
+          'traceEvents' => @mutex.synchronize { events.sort_by { |event| [event['ts'], -event['dur']] } },
+          'displayTimeUnit' => 'ms',
+          'otherData' => {
+            'cocoapods_version' => VERSION,
+            'ruby_version' => RUBY_VERSION,
+          },
+        }
+      end
+
+      # Writes the recorded events as a Chrome trace.
+      #
+      # @param  [String, Pathname] path
+      #         The path of the trace file.
+      #
+      # @return [void]
+      #
+      def write(path)
+        path = Pathname(path)
+        path.dirname.mkpath
+        path.open('w') { |file| file.write(JSON.pretty_generate(to_trace)) }
+      end
+
+      private
+
+      # @return [Integer] The current time of the monotonic clock, in
+      #         microseconds.
+      #
+      def clock_time
+        Process.clock_gettime(Process::CLOCK_MONOTONIC, :microsecond)
+      end
+
+      # @return [Hash{String => Integer}] The counters of the garbage collector
+      #         reported for every section.
+      #
+      def gc_stats
+        stat = GC.stat
+        {
+          'allocations' => stat[:total_allocated_objects],
+          'gc_count' => stat[:count],
+          'major_gc_count' => stat[:major_gc_count],
+          'minor_gc_count' => stat[:minor_gc_count],
+        }
+      end
+    end
+  end
+end
@@ -1,5 +1,6 @@
 require 'active_support/core_ext/array'
 require 'active_support/core_ext/string/inflections'
+require 'stringio'
 
 module Pod
   # Validates a Specification.
@@ -133,6 +134,47 @@ module Pod
       validated?
     end
 
+    # Validates the given validators, running up to `jobs` of them at once in
+    # forked processes. Each validation has its own configuration and
+    # validation directory, while the sources and the specifications loaded
+    # so far are shared with this process, as is the download cache.
+    #
+    # The output of the validations is printed in the order of the
+    # validators, each one once it is finished.
+    #
+    # @param  [Array<Validator>] validators
+    #         the validators to run.
+    #
+    # @param  [Integer] jobs
+    #         the maximum number of validations running at once.
+    #
+    # @yield  [Validator] each validator, in order, once it is validated.
+    #
+    # @return [void]
+    #
+    def self.validate_concurrently(validators, jobs)
+      if jobs <= 1 || validators.count <= 1 || !Process.respond_to?(:fork)
+        validators.each do |validator|
+          validator.validate
+          yield validator if block_given?
+        end
+        return
+      end
+
+      pending = validators.dup
+      running = []
+      begin
+        until pending.empty? && running.empty?
+          running << pending.shift.tap(&:fork_validation) while running.size < jobs && !pending.empty?
+          validator = running.shift
+          validator.join_validation
+          yield validator if block_given?
+        end
+      ensure
+        running.each(&:abort_validation)
+      end
+    end
+
     # Prints the result of the validation to the user.
     #
     # @return [void]
@@ -319,6 +361,79 @@ module Pod
       else :green end
     end
 
+    # Starts to validate the specification in a forked process, which
+    # reports its output, its results and its validation directory through
+    # a pipe.
+    #
+    # @return [void]
+    #
+    def fork_validation
+      $stdout.flush
+      $stderr.flush
+      reader, writer = IO.pipe
+      pid = Process.fork do
+        reader.close
+        output = StringIO.new
+        UI.output_io = output
+        UI.warnings = []
+        error = nil
+        begin
+          validate
+        rescue StandardError => e
+          error = "#{e.class}: #{e.message}"
+        end
+        writer.write(Marshal.dump([output.string, error ? [] : results, UI.warnings, error, @validation_dir]))
+        writer.close
+        exit!(error ? 1 : 0)
+      end
+      writer.close
+      # The pipe is drained while the validation runs, so that the process
+      # never blocks on a full pipe.
+      @validation_process = [pid, Thread.new { reader.read.tap { reader.close } }]
+    end
+
+    # Waits for the validation started by {#fork_validation} and prints its
+    # output.
+    #
+    # @raise  [Informative] If the validation failed unexpectedly.
+    #
+    # @return [Boolean] whether the specification passed validation.
+    #
+    def join_validation
+      pid, output_reader = @validation_process
+      @validation_process = nil
+      data = output_reader.value
+      _, status = Process.wait2(pid)
+      if data.empty?
+        raise Informative, "The validation of `#{file || spec}` exited with status #{status.exitstatus}"
+      end
+
+      output, @results, warnings, error, validation_dir = Marshal.load(data)
+      # The validation directory is created lazily by the forked process.
+      self.validation_dir = validation_dir
+      UI.print output
+      UI.warnings.concat(warnings)
+      raise Informative, "The validation of `#{file || spec}` failed: #{error}" if error
+      validated?
+    end
+
+    # Stops the validation started by {#fork_validation}, discarding its
+    # output.
+    #
+    # @return [void]
+    #
+    def abort_validation
+      pid, output_reader = @validation_process
+      @validation_process = nil
+      begin
+        Process.kill('TERM', pid)
+      rescue Errno::ESRCH
+        nil
+      end
+      Process.wait(pid)
+      output_reader.join
+    end
+
     # @return [Pathname] the temporary directory used by the linter.
     #
     def validation_dir
@@ -1,6 +1,6 @@
 module Pod
   module VersionMetadata
-    CACHE_VERSION = '003'.freeze
+    CACHE_VERSION = '005'.freeze
 
     def self.gem_version
       Pod::VERSION
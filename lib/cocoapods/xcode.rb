@@ -1,5 +1,6 @@
 module Pod
   module Xcode
+    autoload :BinaryMetadataCache, 'cocoapods/xcode/binary_metadata_cache'
     autoload :LinkageAnalyzer, 'cocoapods/xcode/linkage_analyzer'
     autoload :XCFramework, 'cocoapods/xcode/xcframework'
     autoload :FrameworkPaths, 'cocoapods/xcode/framework_paths'
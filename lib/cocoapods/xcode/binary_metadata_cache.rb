@@ -0,0 +1,135 @@
+require 'set'
+
+module Pod
+  module Xcode
+    # Stores the results of the analysis of vendored binaries and of the
+    # Info.plist files of XCFrameworks across installations, so that large
+    # binaries are not opened again as long as they did not change.
+    #
+    # Each result is keyed by the path of the analyzed file and is only valid
+    # as long as the size, the modification time and the inode of the file
+    # are the ones it has been computed with.
+    #
+    class BinaryMetadataCache
+      # @return [Integer] The version of the serialization format. Caches
+      #         saved with a different version are ignored.
+      #
+      FORMAT_VERSION = 1
+
+      class << self
+        # @return [BinaryMetadataCache, Nil] The cache used by the analyzers,
+        #         if one has been loaded for the current installation.
+        #
+        attr_accessor :shared
+
+        # Returns the result for the given file from the shared cache, or
+        # computes it if there is no shared cache.
+        #
+        # @param  [Symbol] kind @see #fetch
+        # @param  [Pathname] file @see #fetch
+        #
+        # @return [Object] The result.
+        #
+        def fetch(kind, file, &block)
+          return yield unless shared
+          shared.fetch(kind, file, &block)
+        end
+      end
+
+      # @return [Pathname] The path of the file the cache is stored in.
+      #
+      attr_reader :path
+
+      # Initialize a new instance
+      #
+      # @param  [Pathname] path @see #path
+      #
+      # @param  [Hash{Array => Array}] entries
+      #         The signature of the analyzed file and the result, keyed by
+      #         the kind of the result and the path of the file.
+      #
+      def initialize(path, entries = {})
+        @path = path
+        @entries = entries
+        @used_keys = Set.new
+        @changed = false
+        @mutex = Mutex.new
+      end
+
+      # Loads the cache stored at the given path.
+      #
+      # @param  [Pathname] path
+      #         The path of the file the cache is stored in.
+      #
+      # @return [BinaryMetadataCache] The cache, which is empty if there is no
+      #         valid cache stored at the given path.
+      #
+      def self.from_file(path)
+        entries = begin
+                    version, stored_entries = Marshal.load(File.binread(path)) if path.file?
+                    stored_entries if version == FORMAT_VERSION
+                  rescue StandardError
+                    nil
+                  end
+        new(path, entries || {})
+      end
+
+      # Returns the result of the given kind for the given file, computing it
+      # if it has not been stored yet or if the file changed since then.
+      #
+      # @param  [Symbol] kind
+      #         The kind of the result.
+      #
+      # @param  [Pathname] file
+      #         The analyzed file.
+      #
+      # @yield  Computes the result.
+      #
+      # @return [Object] The result.
+      #
+      def fetch(kind, file)
+        signature = signature(file)
+        return yield unless signature
+        key = [kind, file.to_s]
+        entry = @mutex.synchronize do
+          @used_keys << key
+          @entries[key]
+        end
+        return entry.last if entry && entry.first == signature
+
+        result = yield
+        @mutex.synchronize do
+          @entries[key] = [signature, result]
+          @changed = true
+        end
+        result
+      end
+
+      # Stores the results which have been used since the cache has been
+      # loaded, if any of them changed.
+      #
+      # @return [void]
+      #
+      def save!
+        entries = @entries.select { |key, _| @used_keys.include?(key) }
+        return unless @changed || entries.size != @entries.size
+        path.dirname.mkpath
+        temp_path = "#{path}.#{Process.pid}.tmp"
+        File.binwrite(temp_path, Marshal.dump([FORMAT_VERSION, entries]))
+        File.rename(temp_path, path)
+      end
+
+      private
+
+      # @return [Array<Integer>, Nil] The size, modification time and inode of
+      #         the given file, or nil if it can not be read.
+      #
+      def signature(file)
+        stat = File.stat(file)
+        [stat.size, stat.mtime.to_i, stat.mtime.nsec, stat.ino]
+      rescue SystemCallError
+        nil
+      end
+    end
+  end
+end
@@ -8,14 +8,22 @@ module Pod
       #
       # @return [Boolean] Whether `binary` can be dynamically linked.
       #
+      # @note   The result is stored in the {BinaryMetadataCache}, if one has
+      #         been loaded, so that the binary is not opened again on the
+      #         next installations as long as it does not change.
+      #
       def self.dynamic_binary?(binary)
         @cached_dynamic_binary_results ||= {}
         return @cached_dynamic_binary_results[binary] unless @cached_dynamic_binary_results[binary].nil?
         return false unless binary.file?
 
-        @cached_dynamic_binary_results[binary] = MachO.open(binary).dylib?
-      rescue MachO::MachOError
-        @cached_dynamic_binary_results[binary] = false
+        @cached_dynamic_binary_results[binary] = BinaryMetadataCache.fetch(:dynamic_binary, binary) do
+          begin
+            MachO.open(binary).dylib?
+          rescue MachO::MachOError
+            false
+          end
+        end
       end
     end
   end
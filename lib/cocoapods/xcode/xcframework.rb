@@ -38,7 +38,9 @@ module Pod
           raise 'Absolute path is required' unless p.absolute?
         end
 
-        @plist = Xcodeproj::Plist.read_from_path(plist_path)
+        @plist = BinaryMetadataCache.fetch(:xcframework_plist, plist_path) do
+          Xcodeproj::Plist.read_from_path(plist_path)
+        end
         parse_plist_contents
       end
 
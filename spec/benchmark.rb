@@ -0,0 +1,111 @@
+# ------------------------------------ #
+#  CocoaPods Benchmarks                #
+# ------------------------------------ #
+
+#-----------------------------------------------------------------------------#
+
+# Measures the phases of clean installations of a synthetic project made of
+# local Pods, with a single Pods project and with a project per Pod.
+#
+# The project is generated in `tmp/benchmark` and every installation runs
+# offline. The results are written as JSON in the same directory, along with
+# a Chrome trace of the last installation of each variant, and compared with
+# a baseline if there is one.
+#
+# The benchmarks are configured with the following environment variables:
+#
+# - `BENCH_SCALE`: `small` (100 Pods), `medium` (1,000 Pods) or `large`
+#   (5,000 Pods). Defaults to `small`.
+# - `BENCH_PODS`: the number of Pods, overriding the scale.
+# - `BENCH_SUBSPEC_DEPTH` and `BENCH_SUBSPEC_WIDTH`: the shape of the subspec
+#   tree of each Pod. Default to 2.
+# - `BENCH_DEPENDENCIES`: the number of other Pods each Pod depends on.
+#   Defaults to 3.
+# - `BENCH_TEST_SPECS` and `BENCH_APP_SPECS`: the ratio of Pods with a test
+#   spec and with an app spec. Default to 0.5 and 0.1.
+# - `BENCH_ITERATIONS`: the number of measured installations per variant, of
+#   which the median is reported. Defaults to 3.
+# - `BENCH_VARIANTS`: the comma-delimited variants to measure, `single`
+#   and/or `multiple`. Defaults to both.
+# - `BENCH_BASELINE`: the results to compare with. Defaults to the baseline
+#   stored for the scale by `rake bench:baseline`.
+# - `BENCH_SAVE_BASELINE`: store the results as the baseline of the scale.
+# - `BENCH_MAX_REGRESSION`: fail if a phase is slower than the baseline by
+#   more than the given percentage.
+
+#-----------------------------------------------------------------------------#
+
+# @return [Pathname] The root of the repo.
+#
+ROOT = Pathname.new(File.expand_path('../../', __FILE__)) unless defined? ROOT
+$:.unshift((ROOT + 'lib').to_s)
+$:.unshift((ROOT + 'spec').to_s)
+
+BENCH_ROOT = ROOT + 'tmp/benchmark'
+ENV['CP_HOME_DIR'] = (BENCH_ROOT + 'home').to_s
+ENV['COCOAPODS_DISABLE_STATS'] = 'true'
+
+require 'rubygems'
+require 'bundler/setup'
+require 'json'
+require 'time'
+require 'cocoapods'
+require 'benchmark/synthetic_project'
+require 'benchmark/runner'
+require 'benchmark/report'
+
+SCALES = { 'small' => 100, 'medium' => 1_000, 'large' => 5_000 }.freeze
+
+scale = ENV.fetch('BENCH_SCALE', 'small')
+raise "Unknown scale `#{scale}`, supported scales are #{SCALES.keys.join(', ')}" unless SCALES.key?(scale)
+
+options = {
+  :pods => Integer(ENV.fetch('BENCH_PODS', SCALES[scale])),
+  :subspec_depth => Integer(ENV.fetch('BENCH_SUBSPEC_DEPTH', 2)),
+  :subspec_width => Integer(ENV.fetch('BENCH_SUBSPEC_WIDTH', 2)),
+  :dependencies => Integer(ENV.fetch('BENCH_DEPENDENCIES', 3)),
+  :test_specs => Float(ENV.fetch('BENCH_TEST_SPECS', 0.5)),
+  :app_specs => Float(ENV.fetch('BENCH_APP_SPECS', 0.1)),
+}
+iterations = Integer(ENV.fetch('BENCH_ITERATIONS', 3))
+variants = { 'single' => false, 'multiple' => true }.select do |name, _|
+  ENV.fetch('BENCH_VARIANTS', 'single,multiple').split(',').include?(name)
+end
+baseline_path = Pathname(ENV.fetch('BENCH_BASELINE', BENCH_ROOT + "baseline-#{scale}.json"))
+
+puts "Generating #{options[:pods]} Pods"
+project = Pod::Benchmark::SyntheticProject.new(BENCH_ROOT + "project-#{scale}", options)
+project.generate!
+
+runner = Pod::Benchmark::Runner.new(project, iterations, BENCH_ROOT + "traces-#{scale}")
+results = {
+  'cocoapods_version' => Pod::VERSION,
+  'ruby_version' => RUBY_VERSION,
+  'created_at' => Time.now.utc.iso8601,
+  'scale' => scale,
+  'options' => Hash[options.map { |key, value| [key.to_s, value] }],
+  'iterations' => iterations,
+  'variants' => Hash[variants.map do |name, multiple_projects|
+    puts "Measuring #{iterations} installations with #{multiple_projects ? 'a project per Pod' : 'a single project'}"
+    [name, runner.run(name, multiple_projects)]
+  end],
+}
+
+results_path = BENCH_ROOT + "results-#{scale}-#{Time.now.strftime('%Y%m%d%H%M%S')}.json"
+results_path.write(JSON.pretty_generate(results))
+puts "Results written to #{results_path}"
+
+baseline = JSON.parse(baseline_path.read) if baseline_path.file?
+report = Pod::Benchmark::Report.new(results, baseline)
+puts
+puts report.to_s
+
+if ENV['BENCH_SAVE_BASELINE']
+  baseline_path.write(JSON.pretty_generate(results))
+  puts "\nBaseline written to #{baseline_path}"
+elsif baseline && (max_regression = ENV['BENCH_MAX_REGRESSION'])
+  regressions = report.regressions(Float(max_regression) / 100)
+  unless regressions.empty?
+    abort "\n#{regressions.count} phases are more than #{max_regression}% slower than the baseline."
+  end
+end
@@ -0,0 +1,64 @@
+module Pod
+  module Benchmark
+    # Compares the results of a benchmark run with the ones of a baseline.
+    #
+    class Report
+      # @return [Hash] The results of the benchmark run.
+      #
+      attr_reader :results
+
+      # @return [Hash, Nil] The results of the baseline, if any.
+      #
+      attr_reader :baseline
+
+      # Initialize a new instance
+      #
+      # @param  [Hash] results @see #results
+      # @param  [Hash, Nil] baseline @see #baseline
+      #
+      def initialize(results, baseline)
+        @results = results
+        @baseline = baseline
+      end
+
+      # @return [Array<Array>] The variant, the phase, the wall time of the
+      #         baseline and of the run and the relative change of each
+      #         measured phase.
+      #
+      def rows
+        results['variants'].flat_map do |variant, phases|
+          phases.map do |phase, stats|
+            baseline_stats = baseline && baseline.fetch('variants', {}).fetch(variant, {})[phase]
+            baseline_wall = baseline_stats && baseline_stats['wall_ms']
+            change = (stats['wall_ms'] - baseline_wall) / baseline_wall if baseline_wall && baseline_wall > 0
+            [variant, phase, baseline_wall, stats['wall_ms'], change]
+          end
+        end
+      end
+
+      # @param  [Float] max_regression
+      #         The maximum relative slowdown allowed.
+      #
+      # @return [Array<Array>] The rows of the phases slower than the baseline
+      #         by more than the given ratio.
+      #
+      def regressions(max_regression)
+        rows.select { |*, change| change && change > max_regression }
+      end
+
+      # @return [String] The comparison formatted as a table.
+      #
+      def to_s
+        lines = [format('%-60s %12s %12s %9s', 'Phase', 'Baseline', 'Current', 'Change')]
+        rows.each do |variant, phase, baseline_wall, wall, change|
+          lines << format('%-60s %12s %12s %9s',
+                          "#{variant} #{phase}",
+                          baseline_wall ? format('%.1f ms', baseline_wall) : '-',
+                          format('%.1f ms', wall),
+                          change ? format('%+.1f%%', change * 100) : '-')
+        end
+        lines.join("\n")
+      end
+    end
+  end
+end
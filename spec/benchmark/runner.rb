@@ -0,0 +1,132 @@
+module Pod
+  module Benchmark
+    # @return [Array<Array(String, String, Symbol)>] The measured phases of an
+    #         installation, as their name, the class and the method which
+    #         implement them.
+    #
+    PHASES = [
+      ['Installer#install!', 'Pod::Installer', :install!],
+      ['Analyzer#analyze', 'Pod::Installer::Analyzer', :analyze],
+      ['Resolver#resolve', 'Pod::Resolver', :resolve],
+      ['SinglePodsProjectGenerator#generate!', 'Pod::Installer::Xcode::SinglePodsProjectGenerator', :generate!],
+      ['MultiPodsProjectGenerator#generate!', 'Pod::Installer::Xcode::MultiPodsProjectGenerator', :generate!],
+      ['PodsProjectWriter#write!', 'Pod::Installer::Xcode::PodsProjectWriter', :write!],
+      ['TargetIntegrator#integrate!', 'Pod::Installer::UserProjectIntegrator::TargetIntegrator', :integrate!],
+    ].freeze
+
+    # @return [String] The category of the events recorded for the phases.
+    #
+    CATEGORY = 'benchmark'.freeze
+
+    # Wraps the methods implementing the phases so that they are measured
+    # whenever timings are recorded.
+    #
+    # @return [void]
+    #
+    def self.instrument!
+      return if @instrumented
+      PHASES.each do |name, class_name, method_name|
+        instrumentation = Module.new do
+          define_method(method_name) do |*args, &block|
+            timings = UI.timings
+            return super(*args, &block) unless timings
+            timings.measure(name, CATEGORY) { super(*args, &block) }
+          end
+        end
+        Object.const_get(class_name).prepend(instrumentation)
+      end
+      @instrumented = true
+    end
+
+    # Runs clean installations of a {SyntheticProject} and reports the median
+    # of the measurements of each phase.
+    #
+    class Runner
+      # @return [SyntheticProject] The measured project.
+      #
+      attr_reader :project
+
+      # @return [Integer] The number of installations measured per variant.
+      #
+      attr_reader :iterations
+
+      # @return [Pathname] The directory in which the trace of the last
+      #         installation of each variant is written.
+      #
+      attr_reader :traces_root
+
+      # Initialize a new instance
+      #
+      # @param  [SyntheticProject] project @see #project
+      # @param  [Integer] iterations @see #iterations
+      # @param  [Pathname] traces_root @see #traces_root
+      #
+      def initialize(project, iterations, traces_root)
+        @project = project
+        @iterations = iterations
+        @traces_root = traces_root
+      end
+
+      # Measures the installations of a variant of the project.
+      #
+      # @param  [String] variant
+      #         The name of the variant.
+      #
+      # @param  [Boolean] multiple_projects
+      #         Whether the variant generates a project per Pod.
+      #
+      # @return [Hash{String => Hash}] The median wall time in milliseconds,
+      #         allocations and garbage collections of each phase, along with
+      #         the number of times it ran per installation.
+      #
+      def run(variant, multiple_projects)
+        Benchmark.instrument!
+        samples = Array.new(iterations) do |iteration|
+          installation_root = project.generate_installation(variant, multiple_projects)
+          timings = install(installation_root)
+          timings.write(traces_root + "#{variant}.json") if iteration == iterations - 1
+          aggregate(timings.events)
+        end
+        Hash[samples.flat_map(&:keys).uniq.map do |phase|
+          values = samples.map { |sample| sample[phase] }.compact
+          [phase, Hash[values.first.keys.map { |key| [key, median(values.map { |value| value[key] })] }]]
+        end]
+      end
+
+      private
+
+      def install(installation_root)
+        Config.instance = Config.new(false)
+        config = Config.instance
+        config.silent = true
+        config.installation_root = installation_root
+        config.sources_manager.find_or_create_source_with_url(project.spec_repo_url)
+
+        GC.start
+        UI.timings = UserInterface::Timings.new
+        Installer.new(config.sandbox, config.podfile, config.lockfile).install!
+        UI.timings
+      ensure
+        UI.timings = nil
+      end
+
+      def aggregate(events)
+        events.select { |event| event['cat'] == CATEGORY }.group_by { |event| event['name'] }.map do |name, phase_events|
+          stats = {
+            'wall_ms' => phase_events.sum { |event| event['dur'] } / 1000.0,
+            'allocations' => phase_events.sum { |event| event['args']['allocations'] },
+            'gc_count' => phase_events.sum { |event| event['args']['gc_count'] },
+            'calls' => phase_events.count,
+          }
+          [name, stats]
+        end.to_h
+      end
+
+      def median(values)
+        sorted = values.sort
+        middle = sorted.count / 2
+        sorted.count.odd? ? sorted[middle] : (sorted[middle - 1] + sorted[middle]) / 2.0
+      end
+    end
+  end
+end
@@ -0,0 +1,190 @@
+require 'fileutils'
+require 'json'
+
+module Pod
+  module Benchmark
+    # Generates a project made of local Pods, along with the spec repo and the
+    # user project its Podfile needs, so that installations can be measured
+    # offline at any scale.
+    #
+    class SyntheticProject
+      # @return [Pathname] The directory in which the project is generated.
+      #
+      attr_reader :root
+
+      # @return [Hash] The options of the generated project.
+      #
+      attr_reader :options
+
+      # Initialize a new instance
+      #
+      # @param  [Pathname] root @see #root
+      #
+      # @param  [Hash] options
+      #         The scale of the project, with the following keys:
+      #         `:pods`, the number of Pods, `:subspec_depth` and
+      #         `:subspec_width`, the shape of the subspec tree of each Pod,
+      #         `:dependencies`, the number of other Pods each Pod depends on,
+      #         `:test_specs` and `:app_specs`, the ratio of Pods which have a
+      #         test spec and an app spec.
+      #
+      def initialize(root, options)
+        @root = root
+        @options = options
+      end
+
+      # @return [Pathname] The directory of the generated Pods.
+      #
+      def pods_root
+        root + 'pods'
+      end
+
+      # @return [Pathname] The directory of the git repo used as the source of
+      #         the Podfiles.
+      #
+      def spec_repo_root
+        root + 'spec-repo'
+      end
+
+      # @return [String] The URL of the source of the Podfiles.
+      #
+      def spec_repo_url
+        "file://#{spec_repo_root}"
+      end
+
+      # @return [Array<String>] The names of the generated Pods.
+      #
+      def pod_names
+        @pod_names ||= Array.new(options[:pods]) { |index| format('BenchPod%04d', index) }
+      end
+
+      # Generates the Pods and the spec repo.
+      #
+      # @return [void]
+      #
+      def generate!
+        FileUtils.rm_rf(root)
+        random = Random.new(options.fetch(:seed, 1))
+        pod_names.each_with_index do |name, index|
+          dependencies = pod_names.first(index).sample(options[:dependencies], :random => random)
+          generate_pod(name, dependencies.sort, random)
+        end
+        generate_spec_repo
+      end
+
+      # Generates an installation directory with a Podfile including all the
+      # Pods and a user project.
+      #
+      # @param  [String] name
+      #         The name of the installation directory.
+      #
+      # @param  [Boolean] multiple_projects
+      #         Whether the Podfile should generate a project per Pod.
+      #
+      # @return [Pathname] The installation directory.
+      #
+      def generate_installation(name, multiple_projects)
+        installation_root = root + name
+        FileUtils.rm_rf(installation_root)
+        installation_root.mkpath
+        (installation_root + 'Podfile').write(podfile(installation_root, multiple_projects))
+        generate_user_project(installation_root)
+        installation_root
+      end
+
+      private
+
+      # @!group Generation
+
+      def generate_pod(name, dependencies, random)
+        pod_root = pods_root + name
+        spec = {
+          'name' => name,
+          'version' => '1.0.0',
+          'summary' => "The #{name} benchmark Pod.",
+          'homepage' => 'https://cocoapods.org',
+          'license' => 'MIT',
+          'authors' => { 'CocoaPods' => 'hello@cocoapods.org' },
+          'source' => { 'git' => "https://example.com/#{name}.git", 'tag' => '1.0.0' },
+          'platforms' => { 'ios' => '12.0' },
+          'source_files' => 'Sources/*.{h,m}',
+          'dependencies' => Hash[dependencies.map { |dependency| [dependency, []] }],
+        }
+        write_sources(pod_root + 'Sources', name)
+        subspecs = subspecs(pod_root, name, 'Sources', options[:subspec_depth])
+        spec['subspecs'] = subspecs unless subspecs.empty?
+        if random.rand < options[:test_specs]
+          write_sources(pod_root + 'Tests', "#{name}Tests")
+          spec['testspecs'] = [{ 'name' => 'Tests', 'test_type' => 'unit', 'source_files' => 'Tests/*.{h,m}' }]
+        end
+        if random.rand < options[:app_specs]
+          write_sources(pod_root + 'App', "#{name}App")
+          spec['appspecs'] = [{ 'name' => 'App', 'source_files' => 'App/*.{h,m}' }]
+        end
+        (pod_root + "#{name}.podspec.json").write(JSON.pretty_generate(spec))
+      end
+
+      def subspecs(pod_root, name, dir, depth)
+        return [] if depth.zero?
+        Array.new(options[:subspec_width]) do |index|
+          subspec_name = "Part#{index}"
+          subspec_dir = "#{dir}/#{subspec_name}"
+          write_sources(pod_root + subspec_dir, "#{name}#{subspec_dir.tr('/', '')}")
+          subspec = { 'name' => subspec_name, 'source_files' => "#{subspec_dir}/*.{h,m}" }
+          children = subspecs(pod_root, name, subspec_dir, depth - 1)
+          subspec['subspecs'] = children unless children.empty?
+          subspec
+        end
+      end
+
+      def write_sources(dir, class_name)
+        dir.mkpath
+        (dir + "#{class_name}.h").write("@import Foundation;\n\n@interface #{class_name} : NSObject\n@end\n")
+        (dir + "#{class_name}.m").write("#import \"#{class_name}.h\"\n\n@implementation #{class_name}\n@end\n")
+      end
+
+      def generate_spec_repo
+        specs_root = spec_repo_root + 'Specs'
+        specs_root.mkpath
+        (specs_root + '.gitkeep').write('')
+        Dir.chdir(spec_repo_root) do
+          git('init', '--quiet')
+          git('add', '.')
+          git('-c', 'user.name=CocoaPods', '-c', 'user.email=hello@cocoapods.org', 'commit', '--quiet', '-m', 'Benchmark')
+        end
+      end
+
+      def git(*args)
+        raise "Unable to run `git #{args.join(' ')}`" unless system('git', *args)
+      end
+
+      def podfile(installation_root, multiple_projects)
+        pods_path = pods_root.relative_path_from(installation_root)
+        pods = pod_names.map do |name|
+          line = "  pod '#{name}', :path => '#{pods_path + name}'"
+          spec = JSON.parse((pods_root + name + "#{name}.podspec.json").read)
+          line += ", :testspecs => ['Tests']" if spec['testspecs']
+          line += ", :appspecs => ['App']" if spec['appspecs']
+          line
+        end
+        [
+          "source '#{spec_repo_url}'",
+          "install! 'cocoapods', :generate_multiple_pod_projects => #{multiple_projects}",
+          "platform :ios, '12.0'",
+          "project 'Bench.xcodeproj'",
+          '',
+          "target 'Bench' do",
+          *pods,
+          'end',
+          '',
+        ].join("\n")
+      end
+
+      def generate_user_project(installation_root)
+        project = Xcodeproj::Project.new(installation_root + 'Bench.xcodeproj')
+        project.new_target(:application, 'Bench', :ios, '12.0')
+        project.save
+      end
+    end
+  end
+end
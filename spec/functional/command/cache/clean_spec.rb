@@ -15,6 +15,11 @@ module Pod
       e.message.should.match(/specify a pod name or use the --all flag/)
     end
 
+    it 'does not combine --max-size with a pod name' do
+      e = lambda { run_command('cache', 'clean', '--max-size=1G', 'AFNetworking') }.should.raise CLAide::Help
+      e.message.should.match(/can not be combined/)
+    end
+
     it 'asks the pod to clean when multiple matches' do
       e = lambda { run_command('cache', 'clean', 'AFNetworking') }.should.raise Pod::Informative
       e.message.should == '[!] 0 is invalid [1-2]'
@@ -27,5 +27,29 @@ module Pod
         run_command('install', '--repo-update')
       end
     end
+
+    describe 'timings' do
+      before do
+        file = temporary_directory + 'Podfile'
+        File.open(file, 'w') do |f|
+          f.puts('platform :ios')
+          f.puts('pod "Reachability"')
+        end
+        Installer.any_instance.expects(:install!)
+      end
+
+      it 'writes a trace of the installation if that option was given' do
+        path = temporary_directory + 'timings.json'
+        run_command('install', "--timings=#{path}")
+        trace = JSON.parse(path.read)
+        trace['traceEvents'].map { |event| event['name'] }.should == ['pod install']
+        UI.timings.should.be.nil
+      end
+
+      it 'does not record timings by default' do
+        run_command('install')
+        (temporary_directory + 'Pods/timings.json').should.not.exist
+      end
+    end
   end
 end
@@ -39,6 +39,25 @@ module Pod
       (repo2 + 'README').read.should.include 'Updated'
     end
 
+    it 'updates the spec-repos concurrently' do
+      FileUtils.rm_rf(test_repo_path)
+      upstream = repo_make('../upstream')
+      repo2 = repo_clone('../upstream', 'repo2')
+      repo3 = repo_clone('../upstream', 'repo3')
+      repo_make_readme_change('../upstream', 'Updated')
+      Dir.chdir(upstream) { Pod::Executable.capture_command!('git', %w(commit -a -m Update)) }
+      config.sources_manager.expects(:update_search_index_if_needed_in_background).with do |value|
+        value.map { |source, paths| [source.name, paths] }.sort == [['repo2', ['README']], ['repo3', ['README']]]
+      end
+      run_command('repo', 'update', '--jobs=2')
+      (repo2 + 'README').read.should.include 'Updated'
+      (repo3 + 'README').read.should.include 'Updated'
+    end
+
+    it 'requires a positive number of jobs' do
+      lambda { run_command('repo', 'update', '--jobs=0') }.should.raise CLAide::Help
+    end
+
     # Conditionally skip the test if `tmutil` is not available.
     # has_tmutil = system('tmutil', 'version', :out => File::NULL)
     # cit = has_tmutil ? method(:it) : method(:xit)
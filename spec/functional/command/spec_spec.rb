@@ -261,6 +261,19 @@ module Pod
         lambda { cmd.run }.should.not.raise
         UI.output.should.include 'Missing license type'
       end
+
+      it 'lints the given podspecs concurrently' do
+        other_spec_path = temporary_directory + 'Other/JSONKit.podspec.json'
+        other_spec_path.dirname.mkpath
+        FileUtils.cp(@spec_path, other_spec_path)
+        cmd = command('spec', 'lint', '--quick', '--jobs=2', @spec_path, other_spec_path.to_s)
+        exception = lambda { cmd.run }.should.raise Informative
+        exception.message.should.match /2 out of 2 specs failed validation/
+      end
+
+      it 'complains if the number of jobs is not positive' do
+        lambda { run_command('spec', 'lint', '--jobs=0') }.should.raise CLAide::Help
+      end
     end
 
     #-------------------------------------------------------------------------#
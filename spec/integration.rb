@@ -116,6 +116,9 @@ CLIntegracon.configure do |c|
   # Ignore certain OSX files
   c.ignores '.DS_Store'
 
+  # The manifests of the generated support files depend on their modification times
+  c.ignores '**/.support_files_manifest.json'
+
   # Needed for some test cases
   c.ignores '*.podspec'
   c.ignores 'PodTest-hg-source/**/*'
@@ -0,0 +1,61 @@
+require File.expand_path('../../../spec_helper', __FILE__)
+
+module Pod
+  describe Downloader::BlobStore do
+    before do
+      @root = Pathname(Dir.mktmpdir)
+      @store = Downloader::BlobStore.new(@root + 'Blobs')
+      @manifest_path = @root + 'Manifests/BananaLib/1.0.json'
+      @pod_v1 = @root + 'BananaLib/1.0'
+      @pod_v2 = @root + 'BananaLib/2.0'
+      [@pod_v1, @pod_v2].each do |pod|
+        (pod + 'Classes').mkpath
+        (pod + 'Classes/Banana.h').open('w') { |f| f << 'shared' }
+      end
+      (@pod_v1 + 'Classes/Banana.m').open('w') { |f| f << 'version 1' }
+      (@pod_v2 + 'Classes/Banana.m').open('w') { |f| f << 'version 2' }
+    end
+
+    after do
+      @root.rmtree if @root.directory?
+    end
+
+    it 'links the identical files of the deduplicated directories to the same blob' do
+      @store.deduplicate!(@pod_v1, @manifest_path).should.be.true
+      @store.deduplicate!(@pod_v2, @root + 'Manifests/BananaLib/2.0.json').should.be.true
+      File.identical?(@pod_v1 + 'Classes/Banana.h', @pod_v2 + 'Classes/Banana.h').should.be.true
+      File.identical?(@pod_v1 + 'Classes/Banana.m', @pod_v2 + 'Classes/Banana.m').should.be.false
+      (@pod_v1 + 'Classes/Banana.h').read.should == 'shared'
+      (@pod_v2 + 'Classes/Banana.m').read.should == 'version 2'
+    end
+
+    it 'writes the manifest of the deduplicated directory' do
+      @store.deduplicate!(@pod_v1, @manifest_path)
+      manifest = JSON.parse(@manifest_path.read)
+      manifest.keys.sort.should == %w(Classes/Banana.h Classes/Banana.m)
+      File.identical?(@store.blob_path(manifest['Classes/Banana.h']), @pod_v1 + 'Classes/Banana.h').should.be.true
+    end
+
+    it 'does not share a blob between files with different permissions' do
+      FileUtils.chmod(0o755, @pod_v2 + 'Classes/Banana.h')
+      @store.deduplicate!(@pod_v1, @manifest_path)
+      @store.deduplicate!(@pod_v2, @root + 'Manifests/BananaLib/2.0.json')
+      File.identical?(@pod_v1 + 'Classes/Banana.h', @pod_v2 + 'Classes/Banana.h').should.be.false
+    end
+
+    it 'leaves the directory untouched if the file system does not support hard links' do
+      File.stubs(:link).raises(Errno::EPERM)
+      @store.deduplicate!(@pod_v1, @manifest_path).should.be.false
+      @manifest_path.should.not.exist
+      (@pod_v1 + 'Classes/Banana.m').read.should == 'version 1'
+    end
+
+    it 'removes the blobs which are not used anymore' do
+      @store.deduplicate!(@pod_v1, @manifest_path)
+      @store.deduplicate!(@pod_v2, @root + 'Manifests/BananaLib/2.0.json')
+      @pod_v1.rmtree
+      @store.remove_unused_blobs!.should == 'version 1'.bytesize
+      Pathname.glob(@store.root + '*/*').count.should == 2
+    end
+  end
+end
@@ -0,0 +1,79 @@
+require File.expand_path('../../../spec_helper', __FILE__)
+
+module Pod
+  describe Downloader::CacheIndex do
+    before do
+      @root = Pathname(Dir.mktmpdir)
+      @index = Downloader::CacheIndex.new(@root)
+      @entry = {
+        'slug' => 'Release/BananaLib/1.0-a1b2c',
+        'spec_file' => 'Specs/Release/BananaLib/1.0-a1b2c.podspec.json',
+        'name' => 'BananaLib',
+        'version' => '1.0',
+        'release' => true,
+        'size' => 42,
+        'accessed_at' => 1000,
+      }
+    end
+
+    after do
+      @root.rmtree if @root.directory?
+    end
+
+    it 'does not exist until a record is written' do
+      @index.should.not.exist
+      @index.entries.should == {}
+      @index.add(@entry)
+      @index.should.exist
+    end
+
+    it 'returns the added records keyed by slug' do
+      @index.add(@entry)
+      @index.entries.should == { @entry['slug'] => @entry }
+    end
+
+    it 'updates the access time of a cached pod' do
+      @index.add(@entry)
+      @index.touch(@entry['slug'], Time.at(2000))
+      @index.entries[@entry['slug']]['accessed_at'].should == 2000
+    end
+
+    it 'ignores the access of a pod which is not indexed' do
+      @index.touch('Release/OrangeLib/1.0-d3e4f')
+      @index.entries.should == {}
+    end
+
+    it 'forgets the removed pods' do
+      @index.add(@entry)
+      @index.remove(@entry['slug'])
+      @index.entries.should == {}
+    end
+
+    it 'ignores the malformed records' do
+      @index.add(@entry)
+      @index.path.open('a') { |f| f.puts('{"slug": ') }
+      @index.entries.keys.should == [@entry['slug']]
+    end
+
+    it 'replaces the records when it is written' do
+      @index.add(@entry)
+      @index.touch(@entry['slug'])
+      @index.write([@entry])
+      @index.path.readlines.size.should == 1
+    end
+
+    it 'compacts the records once it grows too large' do
+      Downloader::CacheIndex.send(:remove_const, :COMPACTION_THRESHOLD)
+      Downloader::CacheIndex.const_set(:COMPACTION_THRESHOLD, 0)
+      begin
+        @index.add(@entry)
+        3.times { |i| @index.touch(@entry['slug'], Time.at(i)) }
+        @index.path.readlines.size.should == 1
+        @index.entries[@entry['slug']]['accessed_at'].should == 2
+      ensure
+        Downloader::CacheIndex.send(:remove_const, :COMPACTION_THRESHOLD)
+        Downloader::CacheIndex.const_set(:COMPACTION_THRESHOLD, 1024 * 1024)
+      end
+    end
+  end
+end
@@ -61,6 +61,190 @@ module Pod
       path.to_path.should.end_with? @request.slug + '.podspec.json'
     end
 
+    describe 'with an index' do
+      before do
+        @path_for_spec = @cache.send(:path_for_spec, @request)
+        path_for_pod = @cache.send(:path_for_pod, @request)
+        (path_for_pod + 'Classes').mkpath
+        File.open(path_for_pod + 'Classes/a.m', 'w') { |f| f << 'banana' }
+      end
+
+      it 'builds the index from the cached specs when it does not exist' do
+        @path_for_spec.dirname.mkpath
+        @path_for_spec.open('w') { |f| f << @spec.to_pretty_json }
+        descriptor = @cache.cache_descriptors_per_pod['BananaLib'].first
+        descriptor[:spec_file].should == @path_for_spec
+        descriptor[:slug].should == @cache.root + @request.slug
+        descriptor[:version].should == @spec.version
+        descriptor[:release].should.be.true
+        descriptor[:size].should == 'banana'.bytesize
+        @cache.index.should.exist
+      end
+
+      it 'records the cached specs in the index' do
+        @cache.rebuild_index
+        @cache.send(:write_spec, @spec, @path_for_spec)
+        @cache.index.entries.keys.should == [@request.slug]
+        @cache.cache_descriptors_per_pod.keys.should == ['BananaLib']
+      end
+
+      it 'records the slug and the size of the external pods and of the released pods of a podspec' do
+        @cache.rebuild_index
+        external_request = Downloader::Request.new(:name => 'BananaLib', :params => { :git => 'https://example.com/BananaLib.git', :commit => 'abc' })
+        path_for_pod = @cache.send(:path_for_pod, external_request)
+        (path_for_pod + 'Classes').mkpath
+        File.open(path_for_pod + 'Classes/b.m', 'w') { |f| f << 'orange' }
+        [external_request, @request].each do |request|
+          @cache.send(:write_spec, @spec, @cache.send(:path_for_spec, request))
+        end
+        slugs = [external_request.slug, @request.slug]
+        @cache.index.entries.values_at(*slugs).map { |entry| entry['size'] }.should == [6, 6]
+        @cache.rebuild_index
+        @cache.index.entries.values_at(*slugs).map { |entry| entry['size'] }.should == [6, 6]
+      end
+
+      it 'forgets the removed pods' do
+        @cache.send(:write_spec, @spec, @path_for_spec)
+        @cache.remove_from_index(@cache.root + @request.slug)
+        @cache.cache_descriptors_per_pod.should == {}
+      end
+
+      it 'records when a cached pod is used' do
+        @cache.send(:write_spec, @spec, @path_for_spec)
+        @cache.index.expects(:touch).with(@request.slug)
+        @cache.download_pod(@request)
+      end
+    end
+
+    describe 'when bounding its size' do
+      before do
+        @slugs = %w(Release/A/1.0-aaaaa Release/B/1.0-bbbbb External/C/ccccc)
+        entries = @slugs.each_with_index.map do |slug, i|
+          (@cache.root + slug).mkpath
+          spec_file = @cache.root + "Specs/#{slug}.podspec.json"
+          spec_file.dirname.mkpath
+          FileUtils.touch(spec_file)
+          {
+            'slug' => slug,
+            'spec_file' => "Specs/#{slug}.podspec.json",
+            'name' => slug.split('/')[1],
+            'version' => '1.0',
+            'release' => slug.start_with?('Release'),
+            'size' => 100,
+            'accessed_at' => Time.now.to_i - Downloader::Cache::EVICTION_GRACE_PERIOD - 10 + i,
+          }
+        end
+        @cache.index.write(entries)
+      end
+
+      it 'parses the maximum size' do
+        Downloader::Cache.parse_size(nil).should.be.nil
+        Downloader::Cache.parse_size(2048).should == 2048
+        Downloader::Cache.parse_size('500M').should == 500 * 1024 * 1024
+        Downloader::Cache.parse_size('1.5GB').should == (1.5 * 1024**3).to_i
+        should.raise(Informative) { Downloader::Cache.parse_size('lots') }
+      end
+
+      it 'evicts the least recently used pods until the cache fits' do
+        @cache.evict(150).should == @slugs.first(2).map { |slug| @cache.root + slug }
+        (@cache.root + @slugs[0]).should.not.exist
+        (@cache.root + "Specs/#{@slugs[0]}.podspec.json").should.not.exist
+        (@cache.root + @slugs[2]).should.exist
+        @cache.index.entries.keys.should == [@slugs[2]]
+      end
+
+      it 'does not evict anything when the cache fits' do
+        @cache.evict(300).should == []
+        @cache.index.entries.size.should == 3
+      end
+
+      it 'does not evict the pods which have just been used' do
+        @cache.index.touch(@slugs[0])
+        @cache.evict(0).should == @slugs.drop(1).map { |slug| @cache.root + slug }
+        (@cache.root + @slugs[0]).should.exist
+      end
+
+      it 'evicts the pods after downloading an uncached pod' do
+        @cache = Downloader::Cache.new(@cache.root, :max_size => 1024)
+        @cache.expects(:uncached_pod).returns(:response)
+        @cache.expects(:evict).with(1024)
+        @cache.download_pod(@request).should == :response
+      end
+    end
+
+    describe 'when evicting the pods written to the cache' do
+      before do
+        @requests = %w(aaa bbb).map do |commit|
+          Downloader::Request.new(:name => 'BananaLib', :params => { :git => 'https://example.com/BananaLib.git', :commit => commit })
+        end
+        @requests.each_with_index do |request, i|
+          path_for_pod = @cache.send(:path_for_pod, request)
+          path_for_pod.mkpath
+          File.open(path_for_pod + 'Banana.m', 'w') { |f| f << 'b' * 100 }
+          @cache.send(:write_spec, @spec, @cache.send(:path_for_spec, request))
+          @cache.index.touch(request.slug, Time.now - Downloader::Cache::EVICTION_GRACE_PERIOD - 10 + i)
+        end
+      end
+
+      it 'removes the directories of the least recently used pods until the cache fits' do
+        @cache.evict(150).should == [@cache.root + @requests[0].slug]
+        (@cache.root + @requests[0].slug).should.not.exist
+        (@cache.root + @requests[1].slug).should.exist
+        @cache.index.entries.values.map { |entry| entry['size'] }.reduce(0, :+).should.be < 150
+      end
+
+      it 'does not evict the pods which have just been used from the cache' do
+        @cache.download_pod(@requests[0]).location.should == @cache.root + @requests[0].slug
+        @cache.evict(150).should == [@cache.root + @requests[1].slug]
+        (@cache.root + @requests[0].slug).should.exist
+      end
+
+      it 'moves the directories of the pods out of the way before removing them' do
+        slug = @cache.root + @requests[0].slug
+        inode = slug.stat.ino
+        FileUtils.expects(:rm_rf).with do |path|
+          (Pathname(path) + slug.basename).stat.ino == inode && !slug.exist?
+        end
+        @cache.discard(slug)
+      end
+
+      it 'leaves no discarded directories behind' do
+        @cache.evict(0)
+        (@cache.root + '.Trash').children.should.be.empty
+      end
+    end
+
+    describe 'when deduplicating the cached pods' do
+      before do
+        @cache = Downloader::Cache.new(@cache.root, :deduplicate => true)
+        @source = Pathname(Dir.mktmpdir)
+        (@source + 'Classes').mkpath
+        File.open(@source + 'Classes/Banana.h', 'w') { |f| f << 'banana' }
+      end
+
+      after do
+        @source.rmtree if @source.directory?
+      end
+
+      it 'links the files of the cached pod to the blob store and writes its manifest' do
+        destination = @cache.root + @request.slug
+        @cache.send(:copy_and_clean, @source, destination, @spec, @cache.send(:path_for_spec, @request))
+        manifest = JSON.parse(@cache.manifest_path(destination).read)
+        manifest.keys.should == ['Classes/Banana.h']
+        blob = @cache.blob_store.blob_path(manifest['Classes/Banana.h'])
+        File.identical?(blob, destination + 'Classes/Banana.h').should.be.true
+      end
+
+      it 'removes the blobs which are not used by a cached pod anymore' do
+        destination = @cache.root + @request.slug
+        @cache.send(:copy_and_clean, @source, destination, @spec, @cache.send(:path_for_spec, @request))
+        destination.rmtree
+        @cache.remove_manifest(destination)
+        @cache.remove_unused_blobs.should == 'banana'.bytesize
+        @cache.manifest_path(destination).should.not.exist
+      end
+    end
+
     describe 'when the download is not cached' do
       describe 'when downloading a released pod' do
         it 'downloads the source' do
@@ -69,6 +253,64 @@ module Pod
           response = @cache.download_pod(@request)
           response.should == Downloader::Response.new(@cache.root + @request.slug, @spec, @spec.source)
         end
+
+        it 'publishes the pod by renaming its staging directory into place' do
+          destination = @cache.root + @request.slug
+          (destination + 'Obsolete.h').dirname.mkpath
+          FileUtils.touch(destination + 'Obsolete.h')
+          source = Pathname(Dir.mktmpdir)
+          (source + 'Classes').mkpath
+          FileUtils.touch(source + 'Classes/Banana.h')
+          @cache.send(:copy_and_clean, source, destination, @spec, @cache.send(:path_for_spec, @request))
+          destination.find.select(&:file?).should == [destination + 'Classes/Banana.h']
+          destination.dirname.children.map(&:basename).map(&:to_s).grep(/\.tmp\z|\.obsolete\z/).should.be.empty
+          source.rmtree
+        end
+
+        it 'keeps a pod published by another process in the meantime' do
+          destination = @cache.root + @request.slug
+          (destination + 'Classes').mkpath
+          FileUtils.touch(destination + 'Classes/Banana.h')
+          spec_path = @cache.send(:path_for_spec, @request)
+          spec_path.dirname.mkpath
+          FileUtils.touch(spec_path)
+          inode = (destination + 'Classes/Banana.h').stat.ino
+          source = Pathname(Dir.mktmpdir)
+          (source + 'Classes').mkpath
+          FileUtils.touch(source + 'Classes/Banana.h')
+          @cache.send(:copy_and_clean, source, destination, @spec, spec_path)
+          (destination + 'Classes/Banana.h').stat.ino.should == inode
+          destination.dirname.children.map(&:basename).map(&:to_s).grep(/\.tmp\z|\.obsolete\z/).should.be.empty
+          source.rmtree
+        end
+      end
+
+      describe 'when downloading a released pod from a tarball' do
+        it 'extracts the tarball straight into the cache' do
+          @spec.source = { :http => 'https://example.com/BananaLib.tgz' }
+          request = Downloader::Request.new(:spec => @spec, :released => true)
+          destination = @cache.root + request.slug
+          staging = @cache.send(:staging_path, destination)
+          Downloader::StreamingExtractor.any_instance.expects(:extract!).with { |path| path == staging && path.mkpath }
+          @cache.expects(:prepare_and_clean).with(staging, @spec)
+          @cache.expects(:in_tmpdir).never
+          response = @cache.download_pod(request)
+          response.should == Downloader::Response.new(destination, @spec, @spec.source)
+          destination.should.be.directory
+          staging.should.not.exist
+          @cache.send(:path_for_spec, request).should.exist
+        end
+
+        it 'downloads and extracts the tarball if it can not be extracted while it is downloaded' do
+          @spec.source = { :http => 'https://example.com/BananaLib.tgz' }
+          request = Downloader::Request.new(:spec => @spec, :released => true)
+          Downloader::StreamingExtractor.any_instance.expects(:extract!).
+            raises(Downloader::StreamingExtractor::UnsupportedEntryError, 'Unsupported entry')
+          @cache.expects(:download).with(request, anything).returns([Downloader::Response.new(nil, @spec, @spec.source), 'BananaLib' => @spec])
+          @cache.expects(:copy_and_clean).once
+          response = @cache.download_pod(request)
+          response.location.should == @cache.root + request.slug
+        end
       end
 
       describe 'when downloading an un-released pod' do
@@ -135,11 +377,11 @@ module Pod
 
       describe 'because the spec is invalid' do
         before do
-          [@request, @unreleased_request].each do |request|
-            path_for_spec = @cache.send(:path_for_spec, request)
-            path_for_spec.dirname.mkpath
-            path_for_spec.open('w') { |f| f << '{' }
-          end
+          # The cached specification of a released pod is not parsed, so only
+          # the one of the unreleased pod is invalid.
+          path_for_spec = @cache.send(:path_for_spec, @unreleased_request)
+          path_for_spec.dirname.mkpath
+          path_for_spec.open('w') { |f| f << '{' }
         end
 
         behaves_like 'it falls back to download the pod'
@@ -169,6 +411,11 @@ module Pod
           response = @cache.download_pod(@request)
           response.should == Downloader::Response.new(@cache.root + @request.slug, @spec, @spec.source)
         end
+
+        it 'does not parse the cached spec' do
+          Specification.expects(:from_file).never
+          @cache.download_pod(@request).spec.should == @spec
+        end
       end
 
       describe 'when downloading an unreleased pod' do
@@ -0,0 +1,163 @@
+require File.expand_path('../../../spec_helper', __FILE__)
+
+module Pod
+  describe Downloader::StreamingExtractor do
+    before do
+      @tmpdir = Pathname(Dir.mktmpdir)
+      @destination = @tmpdir + 'BananaLib'
+      @archive = @tmpdir + 'BananaLib.tgz'
+      write_archive(@archive, 'BananaLib-1.0/Classes/Banana.h' => 'banana', 'BananaLib-1.0/LICENSE' => 'MIT')
+    end
+
+    after do
+      @tmpdir.rmtree if @tmpdir.directory?
+    end
+
+    def write_archive(path, files)
+      Zlib::GzipWriter.open(path.to_s) do |gzip|
+        Gem::Package::TarWriter.new(gzip) do |tar|
+          files.each do |name, contents|
+            tar.add_file_simple(name, 0o644, contents.bytesize) { |io| io.write(contents) }
+          end
+        end
+      end
+    end
+
+    # Writes an archive whose only file has a name which does not fit in the
+    # header, stored in a GNU long name entry or a pax extended header.
+    def write_long_name_archive(path, name, contents, format)
+      Zlib::GzipWriter.open(path.to_s) do |gzip|
+        if format == :gnu
+          data = "#{name}\0"
+          gzip.write(Gem::Package::TarHeader.new(:name => '././@LongLink', :mode => 0o644, :size => data.bytesize,
+                                                 :prefix => '', :typeflag => 'L').to_s)
+        else
+          record = " path=#{name}\n"
+          length = record.bytesize + (record.bytesize + 4).to_s.length
+          data = "#{length}#{record}"
+          gzip.write(Gem::Package::TarHeader.new(:name => 'PaxHeader', :mode => 0o644, :size => data.bytesize,
+                                                 :prefix => '', :typeflag => 'x').to_s)
+        end
+        gzip.write(data.ljust((data.bytesize + 511) / 512 * 512, "\0"))
+        gzip.write(Gem::Package::TarHeader.new(:name => name[0, 100], :mode => 0o644, :size => contents.bytesize,
+                                               :prefix => '', :typeflag => '0').to_s)
+        gzip.write(contents.ljust(512, "\0"))
+        gzip.write("\0" * 1024)
+      end
+    end
+
+    it 'supports the tarballs of http sources' do
+      Downloader::StreamingExtractor.supports?(:http => 'https://example.com/BananaLib.tar.gz').should.be.true
+      Downloader::StreamingExtractor.supports?(:http => 'https://example.com/BananaLib.tar').should.be.true
+      Downloader::StreamingExtractor.supports?(:http => 'https://example.com/download', :type => 'tgz').should.be.true
+      Downloader::StreamingExtractor.supports?(:http => 'https://example.com/BananaLib.zip').should.be.false
+      Downloader::StreamingExtractor.supports?(:git => 'https://example.com/BananaLib.git').should.be.false
+    end
+
+    it 'extracts the archive and moves its only directory up' do
+      Downloader::StreamingExtractor.new(:http => "file://#{@archive}").extract!(@destination)
+      (@destination + 'Classes/Banana.h').read.should == 'banana'
+      (@destination + 'LICENSE').read.should == 'MIT'
+    end
+
+    it 'keeps the directory of the archive when asked not to flatten it' do
+      Downloader::StreamingExtractor.new(:http => "file://#{@archive}", :flatten => false).extract!(@destination)
+      (@destination + 'BananaLib-1.0/LICENSE').should.exist
+    end
+
+    it 'verifies the checksum of the archive' do
+      sha256 = Digest::SHA256.file(@archive).hexdigest
+      Downloader::StreamingExtractor.new(:http => "file://#{@archive}", :sha256 => sha256).extract!(@destination)
+      (@destination + 'LICENSE').should.exist
+    end
+
+    it 'removes the extracted files when the checksum does not match' do
+      extractor = Downloader::StreamingExtractor.new(:http => "file://#{@archive}", :sha1 => '0' * 40)
+      e = lambda { extractor.extract!(@destination) }.should.raise Downloader::DownloaderError
+      e.message.should.include 'SHA1 hash mismatch'
+      @destination.should.not.exist
+    end
+
+    it 'extracts the files whose name is stored in a GNU long name entry' do
+      name = 'BananaLib.xcframework/ios-arm64/BananaLib.framework/Modules/Deeper/Directory/Structure/module.modulemap'
+      write_long_name_archive(@archive, name, 'module BananaLib {}', :gnu)
+      Downloader::StreamingExtractor.new(:http => "file://#{@archive}", :flatten => false).extract!(@destination)
+      (@destination + name).read.should == 'module BananaLib {}'
+      (@destination + name).dirname.children.should == [@destination + name]
+    end
+
+    it 'extracts the files whose name is stored in a pax extended header' do
+      name = 'BananaLib.xcframework/ios-arm64/BananaLib.framework/Modules/Deeper/Directory/Structure/module.modulemap'
+      write_long_name_archive(@archive, name, 'module BananaLib {}', :pax)
+      Downloader::StreamingExtractor.new(:http => "file://#{@archive}", :flatten => false).extract!(@destination)
+      (@destination + name).read.should == 'module BananaLib {}'
+    end
+
+    it 'raises for the entries which can not be extracted' do
+      Zlib::GzipWriter.open(@archive.to_s) do |gzip|
+        gzip.write(Gem::Package::TarHeader.new(:name => 'fifo', :mode => 0o644, :size => 0, :prefix => '', :typeflag => '6').to_s)
+        gzip.write("\0" * 1024)
+      end
+      should.raise(Downloader::StreamingExtractor::UnsupportedEntryError) do
+        Downloader::StreamingExtractor.new(:http => "file://#{@archive}").extract!(@destination)
+      end
+      @destination.should.not.exist
+    end
+
+    it 'reads the archives of percent-encoded file URLs' do
+      archive = @tmpdir + 'Banana Lib.tgz'
+      FileUtils.mv(@archive, archive)
+      Downloader::StreamingExtractor.new(:http => "file://#{@tmpdir}/Banana%20Lib.tgz").extract!(@destination)
+      (@destination + 'LICENSE').read.should == 'MIT'
+    end
+
+    it 'does not extract files outside of the destination' do
+      write_archive(@archive, '../Evil.h' => 'evil')
+      e = lambda { Downloader::StreamingExtractor.new(:http => "file://#{@archive}").extract!(@destination) }.should.raise Downloader::DownloaderError
+      e.message.should.include 'outside of its root'
+      (@tmpdir + 'Evil.h').should.not.exist
+    end
+
+    it 'does not extract files through a symbolic link pointing outside of the destination' do
+      outside = @tmpdir + 'Outside'
+      outside.mkpath
+      Zlib::GzipWriter.open(@archive.to_s) do |gzip|
+        Gem::Package::TarWriter.new(gzip) do |tar|
+          tar.add_symlink('evil', outside.to_s, 0o777)
+          tar.add_file_simple('evil/Evil.h', 0o644, 4) { |io| io.write('evil') }
+        end
+      end
+      e = lambda { Downloader::StreamingExtractor.new(:http => "file://#{@archive}").extract!(@destination) }.should.raise Downloader::DownloaderError
+      e.message.should.include 'symbolic link outside of its root'
+      (outside + 'Evil.h').should.not.exist
+    end
+
+    it 'does not link files outside of the destination' do
+      secret = @tmpdir + 'Secret'
+      File.write(secret, 'secret')
+      Zlib::GzipWriter.open(@archive.to_s) do |gzip|
+        Gem::Package::TarWriter.new(gzip) do |tar|
+          header = Gem::Package::TarHeader.new(:name => 'Secret', :mode => 0o644, :size => 0, :prefix => '',
+                                               :typeflag => '1', :linkname => '../Secret')
+          gzip.write(header.to_s)
+          tar.add_file_simple('Secret', 0o644, 4) { |io| io.write('evil') }
+        end
+      end
+      e = lambda { Downloader::StreamingExtractor.new(:http => "file://#{@archive}").extract!(@destination) }.should.raise Downloader::DownloaderError
+      e.message.should.include 'hard link outside of its root'
+      secret.read.should == 'secret'
+    end
+
+    it 'extracts the symbolic links pointing inside of the destination' do
+      Zlib::GzipWriter.open(@archive.to_s) do |gzip|
+        Gem::Package::TarWriter.new(gzip) do |tar|
+          tar.add_file_simple('BananaLib.framework/Versions/A/Headers/Banana.h', 0o644, 6) { |io| io.write('banana') }
+          tar.add_symlink('BananaLib.framework/Versions/Current', 'A', 0o777)
+          tar.add_symlink('BananaLib.framework/Headers', 'Versions/Current/Headers', 0o777)
+        end
+      end
+      Downloader::StreamingExtractor.new(:http => "file://#{@archive}").extract!(@destination)
+      (@destination + 'Headers/Banana.h').read.should == 'banana'
+    end
+  end
+end
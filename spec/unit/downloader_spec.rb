@@ -17,5 +17,66 @@ module Pod
       Downloader.expects(:preprocess_request).returns(@request)
       Downloader.download(@request, @target_path, :can_cache => false)
     end
+
+    describe 'materializing a cached pod' do
+      before do
+        @source = @target_path + 'Cache/BananaLib'
+        (@source + 'Classes').mkpath
+        (@source + 'Classes/Banana.h').open('w') { |f| f << 'banana' }
+        File.symlink('Classes/Banana.h', @source + 'Banana.h')
+        @target = @target_path + 'Pods/BananaLib'
+        @target.dirname.mkpath
+      end
+
+      it 'copies the files by default' do
+        Downloader.materialize(@source, @target, :copy)
+        (@target + 'Classes/Banana.h').read.should == 'banana'
+        File.identical?(@source + 'Classes/Banana.h', @target + 'Classes/Banana.h').should.be.false
+      end
+
+      it 'links the files' do
+        Downloader.materialize(@source, @target, :link)
+        File.identical?(@source + 'Classes/Banana.h', @target + 'Classes/Banana.h').should.be.true
+        File.readlink(@target + 'Banana.h').should == 'Classes/Banana.h'
+      end
+
+      it 'copies the files if they can not be linked' do
+        File.stubs(:link).raises(Errno::EXDEV)
+        Downloader.materialize(@source, @target, :link)
+        (@target + 'Classes/Banana.h').read.should == 'banana'
+      end
+
+      it 'copies the files if they can not be cloned' do
+        Executable.stubs(:execute_command).raises(Informative)
+        Downloader.materialize(@source, @target, :clone)
+        (@target + 'Classes/Banana.h').read.should == 'banana'
+      end
+    end
+
+    describe 'copying a cached pod' do
+      before do
+        Downloader.stubs(:preprocess_request).returns(@request)
+        @cache_path = @target_path + 'Cache'
+        @location = @cache_path + 'Release/BananaLib/1.0'
+        @location.mkpath
+        (@location + 'Banana.h').open('w') { |f| f << 'banana' }
+        @target = @target_path + 'Pods/BananaLib'
+      end
+
+      it 'copies the cached pod without locking it' do
+        Downloader::Cache.any_instance.stubs(:download_pod).returns(Downloader::Response.new(@location))
+        Downloader::Cache.expects(:read_lock).with(@location).never
+        Downloader.download(@request, @target, :cache_path => @cache_path)
+        (@target + 'Banana.h').read.should == 'banana'
+      end
+
+      it 'downloads the pod again if it is removed from the cache while it is copied' do
+        removed = Downloader::Response.new(@cache_path + 'Release/BananaLib/removed')
+        Downloader::Cache.any_instance.expects(:download_pod).twice.returns(removed, Downloader::Response.new(@location))
+        result = Downloader.download(@request, @target, :cache_path => @cache_path)
+        result.location.should == @location
+        (@target + 'Banana.h').read.should == 'banana'
+      end
+    end
   end
 end
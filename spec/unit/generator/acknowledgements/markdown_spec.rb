@@ -30,10 +30,14 @@ describe Pod::Generator::Markdown do
     given_path = @generator.class.path_from_basepath(basepath)
     expected_path = config.sandbox.root + 'Pods-acknowledgements.markdown'
 
-    file = mock
-    file.expects(:write).with(equals(@generator.licenses))
-    file.expects(:close)
-    File.expects(:new).with(equals(expected_path), equals('w')).returns(file)
-    @generator.save_as(given_path)
+    @generator.save_as(given_path).should.be.true
+    expected_path.read.should == @generator.licenses
+  end
+
+  it 'does not write the markdown file again if its contents did not change' do
+    path = config.sandbox.root + 'Pods-acknowledgements.markdown'
+    @generator.save_as(path)
+    @generator.save_as(path).should.be.false
+    path.read.should == @generator.licenses
   end
 end
@@ -0,0 +1,57 @@
+require File.expand_path('../../../spec_helper', __FILE__)
+
+module Pod
+  describe Generator::ChangedFileWriter do
+    before do
+      @path = temporary_directory + 'Support Files/file.txt'
+    end
+
+    it 'writes a new file' do
+      Generator::ChangedFileWriter.open(@path) { |io| io << 'Hello' << ', ' << 'World' }.should.be.true
+      @path.read.should == 'Hello, World'
+    end
+
+    it 'leaves a file untouched if its contents did not change' do
+      @path.dirname.mkpath
+      File.write(@path, 'Hello, World')
+      File.utime(Time.at(0), Time.at(0), @path)
+      Generator::ChangedFileWriter.open(@path) { |io| io << 'Hello, ' << 'World' }.should.be.false
+      @path.mtime.should == Time.at(0)
+    end
+
+    it 'writes a file whose contents changed' do
+      @path.dirname.mkpath
+      File.write(@path, 'Hello, World')
+      Generator::ChangedFileWriter.open(@path) { |io| io << 'Hello, ' << 'CocoaPods' }.should.be.true
+      @path.read.should == 'Hello, CocoaPods'
+    end
+
+    it 'writes a file whose contents are a prefix of the existing ones' do
+      @path.dirname.mkpath
+      File.write(@path, 'Hello, World')
+      Generator::ChangedFileWriter.open(@path) { |io| io << 'Hello' }.should.be.true
+      @path.read.should == 'Hello'
+    end
+
+    it 'keeps the permissions of a file whose contents changed' do
+      @path.dirname.mkpath
+      File.write(@path, 'echo 1')
+      File.chmod(0o755, @path)
+      Generator::ChangedFileWriter.open(@path) { |io| io << 'echo 2' }
+      (@path.stat.mode & 0o777).should == 0o755
+    end
+
+    it 'leaves the file untouched if rendering its contents fails' do
+      @path.dirname.mkpath
+      File.write(@path, 'Hello, World')
+      should.raise(RuntimeError) do
+        Generator::ChangedFileWriter.open(@path) do |io|
+          io << 'Goodbye'
+          raise 'Rendering failed'
+        end
+      end
+      @path.read.should == 'Hello, World'
+      @path.dirname.children.should == [@path]
+    end
+  end
+end
@@ -0,0 +1,68 @@
+require File.expand_path('../../../../spec_helper', __FILE__)
+
+module Pod
+  describe Installer::Analyzer::ResolutionCache do
+    before do
+      @spec = fixture_spec('banana-lib/BananaLib.podspec')
+      @sandbox = config.sandbox
+      @podfile = Podfile.new do
+        platform :ios, '10.0'
+        target 'SampleProject' do
+          pod 'BananaLib', '1.0'
+        end
+      end
+      @locked_dependencies = Molinillo::DependencyGraph.new
+      @source = stub(:name => 'master', :url => 'https://github.com/CocoaPods/Specs.git', :repo => temporary_directory)
+      @source.stubs(:specification).with('BananaLib', '1.0').returns(@spec)
+      @target_definition = @podfile.target_definitions['SampleProject']
+      @digest = Installer::Analyzer::ResolutionCache.digest(@podfile, @locked_dependencies, [@source], @sandbox)
+      @cache = Installer::Analyzer::ResolutionCache.new(temporary_directory + 'resolution', @digest)
+    end
+
+    it 'restores the stored resolution' do
+      resolver_spec = Resolver::ResolverSpecification.new(@spec, false, @source)
+      @cache.store(@target_definition => [resolver_spec])
+      resolver_specs_by_target = @cache.load(@podfile.target_definition_list, [@source], @sandbox)
+      resolver_specs_by_target.should == { @target_definition => [resolver_spec] }
+      resolver_specs_by_target[@target_definition].first.source.should.equal @source
+    end
+
+    it 'restores the subspecs of the stored resolution' do
+      subspec = Specification.new(@spec, 'Core')
+      @spec.stubs(:subspec_by_name).with('BananaLib/Core', true, true).returns(subspec)
+      @cache.store(@target_definition => [Resolver::ResolverSpecification.new(subspec, true, @source)])
+      resolver_spec = @cache.load(@podfile.target_definition_list, [@source], @sandbox)[@target_definition].first
+      resolver_spec.spec.should.equal subspec
+      resolver_spec.should.be.used_by_non_library_targets_only
+    end
+
+    it 'ignores the resolution stored for other inputs' do
+      @cache.store(@target_definition => [Resolver::ResolverSpecification.new(@spec, false, @source)])
+      podfile = Podfile.new do
+        platform :ios, '10.0'
+        target 'SampleProject' do
+          pod 'BananaLib', '~> 1.0'
+        end
+      end
+      digest = Installer::Analyzer::ResolutionCache.digest(podfile, @locked_dependencies, [@source], @sandbox)
+      digest.should.not == @digest
+      cache = Installer::Analyzer::ResolutionCache.new(@cache.path, digest)
+      cache.load(podfile.target_definition_list, [@source], @sandbox).should.be.nil
+    end
+
+    it 'ignores the stored resolution when a specification can not be found anymore' do
+      @cache.store(@target_definition => [Resolver::ResolverSpecification.new(@spec, false, @source)])
+      @cache.load(@podfile.target_definition_list, [], @sandbox).should.be.nil
+    end
+
+    it 'changes the digest when the checked out revision of a source changes' do
+      git_dir = temporary_directory + '.git'
+      (git_dir + 'refs/heads').mkpath
+      (git_dir + 'HEAD').open('w') { |f| f << "ref: refs/heads/master\n" }
+      (git_dir + 'refs/heads/master').open('w') { |f| f << "0123456789\n" }
+      Installer::Analyzer::ResolutionCache.source_revision(@source).should == '0123456789'
+      (git_dir + 'refs/heads/master').open('w') { |f| f << "9876543210\n" }
+      Installer::Analyzer::ResolutionCache.source_revision(@source).should == '9876543210'
+    end
+  end
+end
@@ -70,10 +70,18 @@ module Pod
           'disable_input_output_paths' => false,
           'preserve_pod_file_structure' => false,
           'generate_multiple_pod_projects' => false,
+          'parallel_project_writing' => false,
+          'parallel_project_writing_process_count' => 4,
+          'parallel_pod_target_installation' => false,
+          'parallel_pod_target_installation_thread_pool_size' => 8,
           'incremental_installation' => false,
+          'path_list_snapshots' => false,
+          'resolution_cache' => false,
           'skip_pods_project_generation' => false,
           'parallel_pod_downloads' => false,
           'parallel_pod_download_thread_pool_size' => 40,
+          'parallel_pod_installation' => false,
+          'parallel_pod_installation_thread_pool_size' => 8,
         }
       end
 
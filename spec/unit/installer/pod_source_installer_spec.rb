@@ -81,6 +81,25 @@ module Pod
           lambda { @installer.install! }.should.raise(Pod::Informative)
           ENV['COCOAPODS_VERSION'].should.be.nil
         end
+
+        it 'runs the prepare commands of several local Pods concurrently' do
+          working_directory = Dir.pwd
+          preparers = %w(BananaLib OrangeFramework).map do |name|
+            path = temporary_directory + name
+            path.mkpath
+            spec = Spec.new do |s|
+              s.name = name
+              s.prepare_command = "sleep 0.2\necho \"$COCOAPODS_VERSION\" > prepared"
+            end
+            Installer::PodSourcePreparer.new(spec, path)
+          end
+          preparers.map { |preparer| Thread.new { preparer.prepare! } }.each(&:join)
+          preparers.each do |preparer|
+            (preparer.path + 'prepared').read.chomp.should == Pod::VERSION
+          end
+          Dir.pwd.should == working_directory
+          ENV['COCOAPODS_VERSION'].should.be.nil
+        end
       end
 
       #--------------------------------------#
@@ -137,6 +156,30 @@ module Pod
       end
 
       #--------------------------------------#
+
+      describe 'Locking' do
+        it 'does not change the permissions of the files of the download cache linked into the sandbox' do
+          cached_file = temporary_directory + 'Cache/BananaLib/Classes/Banana.m'
+          cached_file.dirname.mkpath
+          cached_file.open('w') { |f| f << 'banana' }
+          cached_file.chmod(0o644)
+          source_file = config.sandbox.pod_dir('BananaLib') + 'Classes/Banana.m'
+          source_file.dirname.mkpath
+          File.link(cached_file, source_file)
+          file_accessor = stub(:source_files => [source_file])
+
+          @installer.lock_files!([file_accessor])
+          (source_file.stat.mode & 0o777).should == 0o444
+          (cached_file.stat.mode & 0o777).should == 0o644
+          File.identical?(cached_file, source_file).should.be.false
+
+          @installer.unlock_files!([file_accessor])
+          (cached_file.stat.mode & 0o777).should == 0o644
+          source_file.read.should == 'banana'
+        end
+      end
+
+      #--------------------------------------#
     end
 
     #-------------------------------------------------------------------------#
@@ -0,0 +1,75 @@
+require File.expand_path('../../../../spec_helper', __FILE__)
+
+module Pod
+  class Installer
+    module ProjectCache
+      describe BinaryCacheFile do
+        before do
+          @path = temporary_directory + '.project_cache/installation_cache'
+          @entries = { 'BananaLib' => { 'CHECKSUM' => 'abc' }, 'OrangeFramework' => { 'CHECKSUM' => 'def' } }
+          @raw_entries = BinaryCacheFile.serialize_entries(@entries) { |hash| hash }
+        end
+
+        it 'round trips a header and its entries' do
+          BinaryCacheFile.write(@path, { 'OBJECT_VERSION' => 50 }, @raw_entries)
+          BinaryCacheFile.should.be.binary(@path)
+          header, raw_entries = BinaryCacheFile.load(@path)
+          header.should == { 'OBJECT_VERSION' => 50 }
+          raw_entries.keys.should == %w(BananaLib OrangeFramework)
+          Marshal.load(raw_entries['OrangeFramework']).should == { 'CHECKSUM' => 'def' }
+        end
+
+        it 'removes the legacy YAML file when writing' do
+          legacy_path = BinaryCacheFile.legacy_yaml_path(@path)
+          legacy_path.dirname.mkpath
+          File.write(legacy_path, "---\n")
+          BinaryCacheFile.write(@path, {}, @raw_entries)
+          legacy_path.should.not.exist
+        end
+
+        it 'does not load an invalid file' do
+          @path.dirname.mkpath
+          File.write(@path, "---\nCACHE_KEYS: {}\n")
+          BinaryCacheFile.should.not.be.binary(@path)
+          BinaryCacheFile.load(@path).should.be.nil
+          File.write(@path, 'CPPCgarbage')
+          BinaryCacheFile.load(@path).should.be.nil
+        end
+
+        describe BinaryCacheFile::LazyEntries do
+          before do
+            @decoded = []
+            @lazy_entries = BinaryCacheFile::LazyEntries.new(@raw_entries.dup) do |hash|
+              @decoded << hash
+              hash['CHECKSUM'].upcase
+            end
+          end
+
+          it 'only decodes the entries which are looked up' do
+            @lazy_entries.keys.should == %w(BananaLib OrangeFramework)
+            @lazy_entries['BananaLib'].should == 'ABC'
+            @lazy_entries['BananaLib'].should == 'ABC'
+            @lazy_entries['Missing'].should.be.nil
+            @decoded.should == [{ 'CHECKSUM' => 'abc' }]
+          end
+
+          it 'behaves like a hash' do
+            @lazy_entries['MonkeyLib'] = 'GHI'
+            @lazy_entries.size.should == 3
+            @lazy_entries.key?('MonkeyLib').should.be.true
+            @lazy_entries.map { |key, value| "#{key}=#{value}" }.should == %w(BananaLib=ABC OrangeFramework=DEF MonkeyLib=GHI)
+            @lazy_entries.should == { 'BananaLib' => 'ABC', 'OrangeFramework' => 'DEF', 'MonkeyLib' => 'GHI' }
+          end
+
+          it 'reuses the serialized form of the entries which have not been replaced' do
+            @lazy_entries['OrangeFramework'] = 'XYZ'
+            serialized = @lazy_entries.serialize { |value| { 'CHECKSUM' => value.downcase } }
+            serialized['BananaLib'].should.equal?(@raw_entries['BananaLib'])
+            Marshal.load(serialized['OrangeFramework']).should == { 'CHECKSUM' => 'xyz' }
+            @decoded.should.be.empty
+          end
+        end
+      end
+    end
+  end
+end
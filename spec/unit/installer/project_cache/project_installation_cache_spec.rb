@@ -0,0 +1,46 @@
+require File.expand_path('../../../../spec_helper', __FILE__)
+
+module Pod
+  class Installer
+    module ProjectCache
+      describe ProjectInstallationCache do
+        before do
+          @path = config.sandbox.project_installation_cache_path
+          @cache_key = TargetCacheKey.new(config.sandbox, :pod_target, 'CHECKSUM' => 'abc', 'SPECS' => ['BananaLib'],
+                                                                        'BUILD_SETTINGS_CHECKSUM' => {}, 'PROJECT_NAME' => 'BananaLib')
+          @cache = ProjectInstallationCache.new({ 'BananaLib' => @cache_key }, { 'Debug' => :debug }, 50,
+                                                { 'cocoapods-keys' => {} }, ActiveSupport::HashWithIndifferentAccess.new('clean' => true))
+        end
+
+        it 'round trips through the binary format' do
+          @cache.save_as(@path)
+          BinaryCacheFile.should.be.binary(@path)
+          cache = ProjectInstallationCache.from_file(config.sandbox, @path)
+          cache.build_configurations.should == { 'Debug' => :debug }
+          cache.project_object_version.should == 50
+          cache.podfile_plugins.should == { 'cocoapods-keys' => {} }
+          cache.installation_options.should == { 'clean' => true }
+          cache.cache_key_by_target_label.keys.should == ['BananaLib']
+          cache.cache_key_by_target_label['BananaLib'].key_difference(@cache_key).should == :none
+        end
+
+        it 'migrates a cache stored in the legacy YAML format' do
+          legacy_path = BinaryCacheFile.legacy_yaml_path(@path)
+          legacy_path.dirname.mkpath
+          File.write(legacy_path, YAMLHelper.convert(@cache.to_hash))
+          cache = ProjectInstallationCache.from_file(config.sandbox, @path)
+          cache.project_object_version.should == 50
+          cache.cache_key_by_target_label['BananaLib'].key_difference(@cache_key).should == :none
+          cache.save_as(@path)
+          legacy_path.should.not.exist
+        end
+
+        it 'returns an empty cache if there is no cache file' do
+          cache = ProjectInstallationCache.from_file(config.sandbox, @path)
+          cache.cache_key_by_target_label.should == {}
+          cache.project_object_version.should.be.nil
+        end
+      end
+    end
+  end
+end
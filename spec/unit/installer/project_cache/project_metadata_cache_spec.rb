@@ -0,0 +1,17 @@
+require File.expand_path('../../../../spec_helper', __FILE__)
+
+module Pod
+  class Installer
+    module ProjectCache
+      describe ProjectMetadataCache do
+        it 'round trips through the binary format' do
+          path = config.sandbox.project_metadata_cache_path
+          cache = ProjectMetadataCache.new(config.sandbox, 'BananaLib' => TargetMetadata.new('BananaLib', 'UUID', 'Pods/BananaLib.xcodeproj'))
+          cache.save_as(path)
+          cache = ProjectMetadataCache.from_file(config.sandbox, path)
+          cache.to_hash.should == { 'BananaLib' => { 'LABEL' => 'BananaLib', 'UUID' => 'UUID', 'PROJECT_PATH' => 'Pods/BananaLib.xcodeproj' } }
+        end
+      end
+    end
+  end
+end
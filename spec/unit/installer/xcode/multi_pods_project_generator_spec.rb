@@ -321,6 +321,19 @@ module Pod
             ]
           end
 
+          it 'installs the same targets per project when installing them concurrently' do
+            serial_projects = @generator.generate!.projects_by_pod_targets.keys
+            serial_targets = Hash[serial_projects.map { |p| [p.project_name, p.targets.map(&:name).sort] }]
+
+            @installation_options.parallel_pod_target_installation = true
+            @installation_options.parallel_pod_target_installation_thread_pool_size = 3
+            pod_generator_result = @generator.generate!
+            projects = pod_generator_result.projects_by_pod_targets.keys
+            Hash[projects.map { |p| [p.project_name, p.targets.map(&:name).sort] }].should == serial_targets
+            pod_generator_result.target_installation_results.pod_target_installation_results.keys.sort.should ==
+              @generator.pod_targets.map(&:name).sort
+          end
+
           it 'installs dependencies for app specs' do
             pod_generator_result = @generator.generate!
             projects = pod_generator_result.projects_by_pod_targets.keys
@@ -622,6 +635,32 @@ module Pod
                                            @generator.installation_options).write!
             end
 
+            it 'saves the projects in parallel processes' do
+              Xcodeproj::Project.any_instance.unstub(:save)
+              @generator.installation_options.stubs(:parallel_project_writing?).returns(true)
+              pod_generator_result = @generator.generate!
+              generated_projects = [pod_generator_result.project] + pod_generator_result.projects_by_pod_targets.keys
+              generated_projects.size.should.be > 1
+              Xcode::PodsProjectWriter.new(@generator.sandbox, generated_projects,
+                                           pod_generator_result.target_installation_results.pod_target_installation_results,
+                                           @generator.installation_options).write!
+              generated_projects.each do |project|
+                (project.path + 'project.pbxproj').should.exist
+                Xcodeproj::Project.open(project.path).targets.map(&:name).should == project.targets.map(&:name)
+              end
+            end
+
+            it 'raises if a project can not be saved in a parallel process' do
+              Xcodeproj::Project.any_instance.stubs(:save).raises(StandardError, 'Disk full')
+              @generator.installation_options.stubs(:parallel_project_writing?).returns(true)
+              pod_generator_result = @generator.generate!
+              generated_projects = [pod_generator_result.project] + pod_generator_result.projects_by_pod_targets.keys
+              writer = Xcode::PodsProjectWriter.new(@generator.sandbox, generated_projects,
+                                                    pod_generator_result.target_installation_results.pod_target_installation_results,
+                                                    @generator.installation_options)
+              should.raise(Informative) { writer.write! }.message.should.include 'StandardError: Disk full'
+            end
+
             it 'project cleans up empty groups' do
               @generator.sandbox.store_local_path('BananaLib', fixture('banana-lib/BananaLib.podspec'))
               pod_generator_result = @generator.generate!
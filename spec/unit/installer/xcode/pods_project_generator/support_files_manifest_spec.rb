@@ -0,0 +1,81 @@
+require File.expand_path('../../../../../spec_helper', __FILE__)
+
+module Pod
+  class Installer
+    class Xcode
+      class PodsProjectGenerator
+        describe SupportFilesManifest do
+          before do
+            @support_files_dir = temporary_directory + 'Target Support Files/BananaLib'
+            @support_files_dir.mkpath
+            @manifest_path = @support_files_dir + SupportFilesManifest::FILE_NAME
+            @path = @support_files_dir + 'BananaLib-dummy.m'
+            @generator = Generator::DummySource.new('BananaLib')
+          end
+
+          def update_file(generator = @generator)
+            manifest = SupportFilesManifest.new(@manifest_path)
+            updated = manifest.update_file(generator, @path) { generator.save_as(@path) }
+            manifest.save
+            updated
+          end
+
+          it 'writes a file which is not in the manifest' do
+            update_file.should.be.true
+            @path.read.should == @generator.generate
+            @manifest_path.should.exist
+          end
+
+          it 'does not run a generator whose inputs did not change' do
+            update_file
+            @generator.expects(:generate).never
+            @generator.expects(:save_as).never
+            update_file.should.be.false
+          end
+
+          it 'compares the contents of the generators without inputs with the recorded digest' do
+            generator = Generator::Header.new(Platform.ios)
+            generator.imports << 'BananaLib.h'
+            update_file(generator)
+            manifest = SupportFilesManifest.new(@manifest_path)
+            manifest.update_file(generator, @path) { raise 'The file should not be written' }.should.be.false
+          end
+
+          it 'writes a file whose inputs changed' do
+            update_file
+            generator = Generator::DummySource.new('OrangeFramework')
+            update_file(generator).should.be.true
+            @path.read.should == generator.generate
+          end
+
+          it 'writes a file which was modified since it was generated' do
+            update_file
+            File.write(@path, 'Modified')
+            update_file.should.be.true
+            @path.read.should == @generator.generate
+          end
+
+          it 'writes a file which was removed since it was generated' do
+            update_file
+            @path.delete
+            update_file.should.be.true
+            @path.should.exist
+          end
+
+          it 'drops the files which are not generated anymore' do
+            update_file
+            manifest = SupportFilesManifest.new(@manifest_path)
+            manifest.save
+            SupportFilesManifest.new(@manifest_path).update_file(@generator, @path) {}.should.be.true
+          end
+
+          it 'ignores a manifest saved in a different format' do
+            update_file
+            @manifest_path.open('w') { |f| f << JSON.generate('version' => 0, 'files' => {}) }
+            update_file.should.be.true
+          end
+        end
+      end
+    end
+  end
+end
@@ -630,8 +630,8 @@ module Pod
 
         it 'cleans the header stores' do
           @installer.pod_targets.each do |pods_target|
-            pods_target.build_headers.expects(:implode_path!)
-            config.sandbox.public_headers.expects(:implode_path!).with(pods_target.headers_sandbox)
+            pods_target.build_headers.expects(:reconcile_path!)
+            config.sandbox.public_headers.expects(:reconcile_path!).with(pods_target.headers_sandbox)
           end
           @installer.install!
         end
@@ -705,6 +705,48 @@ module Pod
           @installer.send(:install_pod_sources)
         end
 
+        it 'downloads and installs Pods in a pipeline when parallel pod installation is on' do
+          spec = fixture_spec('banana-lib/BananaLib.podspec')
+          spec_2 = Spec.new
+          spec_2.name = 'RestKit'
+          spec_3 = Spec.new
+          spec_3.name = 'JSONKit'
+          @installer.stubs(:root_specs).returns([spec, spec_2, spec_3])
+          @installer.stubs(:installation_options).returns(Pod::Installer::InstallationOptions.new(:parallel_pod_installation => true))
+          sandbox_state = Installer::Analyzer::SpecsState.new
+          sandbox_state.added << 'BananaLib'
+          sandbox_state.changed << 'RestKit'
+          @installer.stubs(:sandbox_state).returns(sandbox_state)
+          installers = [spec, spec_2, spec_3].map do |s|
+            installer = stub(:specs_by_platform => { :ios => [s] })
+            @installer.stubs(:create_pod_installer).with(s.name).returns(installer)
+            installer
+          end
+          @installer.expects(:download_source_of_pod).with('BananaLib')
+          @installer.expects(:download_source_of_pod).with('RestKit')
+          @installer.expects(:download_source_of_pod).with('JSONKit').never
+          installers[0].expects(:install!)
+          installers[1].expects(:install!)
+          installers[2].expects(:install!).never
+          @installer.instance_variable_set(:@installed_specs, [])
+          @installer.send(:install_pod_sources)
+          @installer.installed_specs.should == [spec, spec_2]
+        end
+
+        it 'raises the error of a Pod that failed to download in the pipeline' do
+          spec = fixture_spec('banana-lib/BananaLib.podspec')
+          @installer.stubs(:root_specs).returns([spec])
+          @installer.stubs(:installation_options).returns(Pod::Installer::InstallationOptions.new(:parallel_pod_installation => true))
+          sandbox_state = Installer::Analyzer::SpecsState.new
+          sandbox_state.added << 'BananaLib'
+          @installer.stubs(:sandbox_state).returns(sandbox_state)
+          installer = stub(:specs_by_platform => { :ios => [spec] })
+          installer.expects(:install!).never
+          @installer.stubs(:create_pod_installer).with('BananaLib').returns(installer)
+          @installer.stubs(:download_source_of_pod).raises(Informative, 'Failed to download')
+          should.raise(Informative) { @installer.send(:install_pod_sources) }.message.should.include 'Failed to download'
+        end
+
         it 'correctly configures the Pod source installer' do
           spec = fixture_spec('banana-lib/BananaLib.podspec')
           pod_target = PodTarget.new(config.sandbox, BuildType.static_library, {}, [], Platform.ios, [spec], [fixture_target_definition],
@@ -962,6 +1004,14 @@ module Pod
             @installer.send(:clean_pod_sources)
             Installer::PodSourceInstaller.any_instance.expects(:install!).never
           end
+
+          it 'cleans all the Pod sources when parallel pod installation is on' do
+            @installer.stubs(:installation_options).returns(Pod::Installer::InstallationOptions.new(:parallel_pod_installation => true))
+            @installer.stubs(:installed_specs).returns([fixture_spec('banana-lib/BananaLib.podspec')])
+            installers = Array.new(3) { stub.tap { |installer| installer.expects(:clean!) } }
+            @installer.stubs(:pod_installers).returns(installers)
+            @installer.send(:clean_pod_sources)
+          end
         end
 
         #--------------------------------------#
@@ -998,6 +1048,56 @@ module Pod
           lockfile.pod_names.should == ['BananaLib']
         end
       end
+
+      describe '#write_path_list_snapshots' do
+        before do
+          spec = fixture_spec('banana-lib/BananaLib.podspec')
+          @path_list = Sandbox::PathList.new(fixture('banana-lib'))
+          file_accessor = Sandbox::FileAccessor.new(@path_list, spec.consumer(:ios))
+          pod_target = PodTarget.new(config.sandbox, BuildType.static_library, {}, [], Platform.ios, [spec],
+                                     [fixture_target_definition], [file_accessor])
+          @installer.stubs(:pod_targets).returns([pod_target])
+          @installer.stubs(:sandbox_state).returns(Installer::Analyzer::SpecsState.new)
+          @installer.stubs(:lockfile).returns(stub(:checksum => 'checksum', :checkout_options_for_pod_named => nil))
+          @installer.stubs(:installation_options).returns(Pod::Installer::InstallationOptions.new(:path_list_snapshots => true))
+          @snapshot_path = config.sandbox.path_list_snapshot_path('BananaLib')
+        end
+
+        it 'writes the snapshot of the path list of every pod' do
+          @installer.send(:write_path_list_snapshots)
+          key = Sandbox::PathListSnapshot.key_for(@installer.lockfile, 'BananaLib')
+          Sandbox::PathListSnapshot.new(@snapshot_path, key).load.should == [@path_list.files, @path_list.dirs]
+        end
+
+        it 'does not load nor write again the up to date snapshot of a pod which has not been installed again' do
+          key = Sandbox::PathListSnapshot.key_for(@installer.lockfile, 'BananaLib')
+          Sandbox::PathListSnapshot.new(@snapshot_path, key).save(['Banana.h'], [])
+          @path_list.snapshot = Sandbox::PathListSnapshot.new(@snapshot_path, key)
+          @path_list.expects(:load_file_system).never
+          Sandbox::PathListSnapshot.any_instance.expects(:save).never
+          @installer.send(:write_path_list_snapshots)
+        end
+
+        it 'writes again the snapshot of a pod which has been installed again' do
+          key = Sandbox::PathListSnapshot.key_for(@installer.lockfile, 'BananaLib')
+          Sandbox::PathListSnapshot.new(@snapshot_path, key).save(['Banana.h'], [])
+          @installer.stubs(:sandbox_state).returns(Installer::Analyzer::SpecsState.new(:changed => ['BananaLib']))
+          @installer.send(:write_path_list_snapshots)
+          Sandbox::PathListSnapshot.new(@snapshot_path, key).load.should == [@path_list.files, @path_list.dirs]
+        end
+
+        it 'does not write the snapshot of a local pod' do
+          config.sandbox.stubs(:local?).returns(true)
+          @installer.send(:write_path_list_snapshots)
+          @snapshot_path.should.not.exist
+        end
+
+        it 'does not write any snapshot unless the installation option is set' do
+          @installer.stubs(:installation_options).returns(Pod::Installer::InstallationOptions.new)
+          @installer.send(:write_path_list_snapshots)
+          @snapshot_path.should.not.exist
+        end
+      end
     end
 
     #-------------------------------------------------------------------------#
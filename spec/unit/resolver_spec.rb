@@ -45,6 +45,26 @@ module Pod
           possibilities = @resolver.search_for(Dependency.new('SDWebImage/Core'))
           possibilities.should.not.include? nil
         end
+
+        it 'shares the specification of a version between the requirements it satisfies' do
+          @resolver.instance_variable_set(:@cached_sets, {})
+          loose = @resolver.search_for(Dependency.new('BlocksKit', '>= 1.0'))
+          strict = @resolver.search_for(Dependency.new('BlocksKit', '1.5.2'))
+          loose.find { |spec| spec.version == Version.new('1.5.2') }.should.equal strict.last
+        end
+
+        it 'raises for a missing subspec even if it has been looked up without raising' do
+          @resolver.instance_variable_set(:@cached_sets, {})
+          spec = @resolver.search_for(Dependency.new('BlocksKit', '1.5.2')).last
+          spec.subspec_by_name('BlocksKit/Missing', false).should.be.nil
+          should.raise(Informative) { spec.subspec_by_name('BlocksKit/Missing') }
+        end
+
+        it 'computes the dependencies of a specification once' do
+          spec = Spec.new { |s| s.name = 'lib' }
+          spec.expects(:all_dependencies).once.returns([Dependency.new('AFNetworking')])
+          2.times { @resolver.dependencies_for(spec).should == [Dependency.new('AFNetworking')] }
+        end
       end
 
       #--------------------------------------#
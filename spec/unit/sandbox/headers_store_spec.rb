@@ -44,6 +44,78 @@ module Pod
       @public_header_dir.search_paths(fake_platform).should.not.include('${PODS_ROOT}/Headers/Public/ExampleLib')
     end
 
+    describe 'reconciliation' do
+      before do
+        FileUtils.mkdir_p(@sandbox.root + 'ExampleLib/')
+        @namespace_path = Pathname.new('ExampleLib')
+        @relative_header_paths = %w(MyHeader.h MyOtherHeader.h).map { |name| Pathname.new("ExampleLib/#{name}") }
+        @relative_header_paths.each do |path|
+          File.open(@sandbox.root + path, 'w') { |file| file.write('hello') }
+        end
+        @public_header_dir.add_files(@namespace_path, @relative_header_paths)
+      end
+
+      it 'does not recreate the symlinks which did not change' do
+        @public_header_dir.reconcile_path!(@namespace_path)
+        FileUtils.expects(:ln_sf).never
+        symlink_paths = @public_header_dir.add_files(@namespace_path, @relative_header_paths)
+        @public_header_dir.finish_reconciliation!(@namespace_path)
+        symlink_paths.each do |path|
+          path.should.be.symlink
+          File.read(path).should == 'hello'
+        end
+      end
+
+      it 'removes the entries which have not been added again' do
+        @public_header_dir.add_files(@namespace_path + 'Nested', @relative_header_paths)
+        @public_header_dir.reconcile_path!(@namespace_path)
+        @public_header_dir.add_files(@namespace_path, @relative_header_paths.first(1))
+        @public_header_dir.finish_reconciliation!(@namespace_path)
+        root = @public_header_dir.root + @namespace_path
+        root.children.should == [root + 'MyHeader.h']
+      end
+
+      it 'removes the reconciled directory if nothing has been added to it' do
+        @public_header_dir.reconcile_path!(@namespace_path)
+        @public_header_dir.finish_reconciliation!(@namespace_path)
+        (@public_header_dir.root + @namespace_path).should.not.exist
+      end
+
+      it 'keeps the symlinks added by every store sharing the directory' do
+        variant_a = Sandbox::HeadersStore.new(@sandbox, 'Public', :public)
+        variant_b = Sandbox::HeadersStore.new(@sandbox, 'Public', :public)
+        [variant_a, variant_b].each { |store| store.reconcile_path!(@namespace_path) }
+        variant_a.add_files(@namespace_path, @relative_header_paths.first(1))
+        variant_b.add_files(@namespace_path, @relative_header_paths.drop(1))
+        [variant_a, variant_b].each { |store| store.finish_reconciliation!(@namespace_path) }
+        root = @public_header_dir.root + @namespace_path
+        root.children.sort.should == [root + 'MyHeader.h', root + 'MyOtherHeader.h']
+      end
+
+      it 'keeps a symlink which moved to another store sharing the directory' do
+        variant_a = Sandbox::HeadersStore.new(@sandbox, 'Public', :public)
+        variant_b = Sandbox::HeadersStore.new(@sandbox, 'Public', :public)
+        [variant_a, variant_b].each { |store| store.reconcile_path!(@namespace_path) }
+        variant_a.add_files(@namespace_path, @relative_header_paths.drop(1))
+        variant_b.add_files(@namespace_path, @relative_header_paths.first(1))
+        variant_a.finish_reconciliation!(@namespace_path)
+        variant_b.finish_reconciliation!(@namespace_path)
+        root = @public_header_dir.root + @namespace_path
+        root.children.sort.should == [root + 'MyHeader.h', root + 'MyOtherHeader.h']
+        File.read(root + 'MyHeader.h').should == 'hello'
+      end
+
+      it 'replaces the symlinks whose source changed' do
+        File.open(@sandbox.root + 'ExampleLib/Other', 'w') { |file| file.write('other') }
+        File.unlink(@public_header_dir.root + 'ExampleLib/MyHeader.h')
+        File.symlink('../../../ExampleLib/Other', @public_header_dir.root + 'ExampleLib/MyHeader.h')
+        @public_header_dir.reconcile_path!(@namespace_path)
+        @public_header_dir.add_files(@namespace_path, @relative_header_paths)
+        @public_header_dir.finish_reconciliation!(@namespace_path)
+        File.read(@public_header_dir.root + 'ExampleLib/MyHeader.h').should == 'hello'
+      end
+    end
+
     describe 'non modular header search paths' do
       it 'returns the correct public header search paths for the given platform' do
         @public_header_dir.add_search_path('iOS Search Path', Platform.ios)
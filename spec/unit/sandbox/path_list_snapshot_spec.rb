@@ -0,0 +1,64 @@
+require File.expand_path('../../../spec_helper', __FILE__)
+
+module Pod
+  describe Sandbox::PathListSnapshot do
+    before do
+      @path = temporary_directory + '.path_list_snapshots/BananaLib'
+      @snapshot = Sandbox::PathListSnapshot.new(@path, 'key')
+    end
+
+    describe '::key_for' do
+      before do
+        @lockfile = stub(:checksum => 'checksum', :checkout_options_for_pod_named => { :git => 'url', :commit => 'abc' })
+      end
+
+      it 'returns a key derived from the checksum and the checkout options of a pod' do
+        key = Sandbox::PathListSnapshot.key_for(@lockfile, 'BananaLib')
+        key.should == Sandbox::PathListSnapshot.key_for(@lockfile, 'BananaLib')
+        @lockfile.stubs(:checkout_options_for_pod_named).returns(:commit => 'abc', :git => 'url')
+        Sandbox::PathListSnapshot.key_for(@lockfile, 'BananaLib').should == key
+        @lockfile.stubs(:checkout_options_for_pod_named).returns(:git => 'url', :commit => 'def')
+        Sandbox::PathListSnapshot.key_for(@lockfile, 'BananaLib').should.not == key
+        @lockfile.stubs(:checksum).returns('other checksum')
+        Sandbox::PathListSnapshot.key_for(@lockfile, 'BananaLib').should.not == key
+      end
+
+      it 'returns nil if the lockfile does not store a checksum for the pod' do
+        @lockfile.stubs(:checksum).returns(nil)
+        Sandbox::PathListSnapshot.key_for(@lockfile, 'BananaLib').should.be.nil
+        Sandbox::PathListSnapshot.key_for(nil, 'BananaLib').should.be.nil
+      end
+    end
+
+    it 'round trips a listing' do
+      files = ['Classes/Banana.h', 'Classes/Banana.m', "Resources/ü.png"]
+      dirs = %w(Classes Resources)
+      @snapshot.save(files, dirs)
+      @snapshot.load.should == [files, dirs]
+    end
+
+    it 'round trips an empty listing' do
+      @snapshot.save([], [])
+      @snapshot.load.should == [[], []]
+    end
+
+    it 'does not load a listing saved for another key' do
+      @snapshot.save(['Banana.h'], [])
+      Sandbox::PathListSnapshot.new(@path, 'other key').load.should.be.nil
+    end
+
+    it 'is valid only if it has been saved for its key' do
+      @snapshot.should.not.be.valid
+      @snapshot.save(['Banana.h'], [])
+      @snapshot.should.be.valid
+      Sandbox::PathListSnapshot.new(@path, 'other key').should.not.be.valid
+    end
+
+    it 'does not load a missing or corrupted snapshot' do
+      @snapshot.load.should.be.nil
+      @path.dirname.mkpath
+      File.write(@path, 'garbage')
+      @snapshot.load.should.be.nil
+    end
+  end
+end
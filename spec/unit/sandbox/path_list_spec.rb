@@ -228,6 +228,42 @@ module Pod
           Classes/Banana.m
         )
       end
+
+      it 'shares the matches of a pattern between the globs which include it' do
+        paths = @path_list.relative_glob(['Classes/*.h', 'Resources/*'])
+        @path_list.expects(:candidates).never
+        @path_list.relative_glob(['Resources/*', 'Classes/*.h']).sort.should == paths.sort
+      end
+
+      it 'shares the matches of the exclude patterns between the globs which include them' do
+        @path_list.relative_glob(['Classes/*.h'], :exclude_patterns => ['Classes/*Private*'])
+        @path_list.relative_glob(['Classes/*.m'])
+        @path_list.expects(:candidates).never
+        paths = @path_list.relative_glob(['Classes/*.h', 'Classes/*.m'], :exclude_patterns => ['Classes/*Private*'])
+        paths.map(&:to_s).should == %w(Classes/Banana.h Classes/Banana.m)
+      end
+    end
+
+    #-------------------------------------------------------------------------#
+
+    describe 'Interned paths' do
+      it 'returns frozen paths shared by the globs which match them' do
+        header = @path_list.glob('Classes/*.h').first
+        header.should.be.frozen
+        @path_list.glob(['Classes/Banana.h']).first.should.equal?(header)
+        @path_list.relative_glob('Classes/*.h').first.should.equal?(@path_list.relative_pathname('Classes/Banana.h'))
+      end
+
+      it 'returns frozen path strings' do
+        @path_list.files.each { |file| file.should.be.frozen }
+      end
+
+      it 'computes the path of a file relative to a directory once' do
+        header = @path_list.root + 'Classes/Banana.h'
+        relative_path = @path_list.relative_path_from(header, @path_list.root.dirname)
+        relative_path.should == Pathname.new('banana-lib/Classes/Banana.h')
+        @path_list.relative_path_from(header, @path_list.root.dirname).should.equal?(relative_path)
+      end
     end
 
     describe 'Reading file system' do
@@ -255,6 +291,38 @@ module Pod
 
     #-------------------------------------------------------------------------#
 
+    describe 'Snapshots' do
+      before do
+        @snapshot = Sandbox::PathListSnapshot.new(temporary_directory + 'BananaLib', 'key')
+      end
+
+      it 'loads the paths from a valid snapshot instead of the file system' do
+        @snapshot.save(['Classes/Banana.h'], ['Classes'])
+        @path_list.snapshot = @snapshot
+        Dir.expects(:glob).never
+        @path_list.files.should == ['Classes/Banana.h']
+        @path_list.dirs.should == ['Classes']
+        @path_list.should.be.loaded_from_snapshot
+        @path_list.relative_glob('classes/*.h').should == [Pathname('Classes/Banana.h')]
+      end
+
+      it 'reads the file system if the snapshot is not valid' do
+        @path_list.snapshot = @snapshot
+        @path_list.files.should.include 'Classes/Banana.h'
+        @path_list.should.not.be.loaded_from_snapshot
+      end
+
+      it 'always reads the file system when explicitly requested' do
+        @snapshot.save(['Classes/Banana.h'], ['Classes'])
+        @path_list.snapshot = @snapshot
+        @path_list.read_file_system
+        @path_list.files.should.include 'Classes/Banana.m'
+        @path_list.should.not.be.loaded_from_snapshot
+      end
+    end
+
+    #-------------------------------------------------------------------------#
+
     describe 'Private Helpers' do
       describe '#directory?' do
         it 'detects a directory' do
@@ -268,6 +336,41 @@ module Pod
 
       #--------------------------------------#
 
+      describe '#candidates' do
+        it 'only returns the subtree of the literal prefix of a pattern' do
+          candidates = @path_list.send(:candidates, ['classes/**/*.h', 'Classes/*.h'], false)
+          candidates.should.not.be.empty
+          candidates.all? { |path| path.start_with?('Classes/') }.should.be.true
+          candidates.should == @path_list.files.select { |path| path.start_with?('Classes/') }
+        end
+
+        it 'returns the whole list if a pattern does not have a literal prefix' do
+          @path_list.send(:candidates, ['Classes/*.h', '**/*.h'], true).should == @path_list.files + @path_list.dirs
+        end
+
+        it 'returns the union of the subtrees of multiple patterns in the order of the list' do
+          candidates = @path_list.send(:candidates, ['Resources/*.png', 'Classes/*.h'], false)
+          candidates.should == @path_list.files.select { |path| path =~ %r{^(Classes|Resources)/} }
+        end
+
+        it 'does not return anything for an unknown literal prefix' do
+          @path_list.send(:candidates, ['Missing/*.h'], true).should.be.empty
+        end
+      end
+
+      #--------------------------------------#
+
+      describe '#literal_prefix' do
+        it 'returns the case folded leading directories without glob metacharacters' do
+          @path_list.send(:literal_prefix, 'Classes/Sub/**/*.h').should == 'classes/sub'
+          @path_list.send(:literal_prefix, 'Classes/Banana.h').should == 'classes'
+          @path_list.send(:literal_prefix, 'Cl[a]sses/Banana.h').should.be.nil
+          @path_list.send(:literal_prefix, 'Banana.h').should.be.nil
+        end
+      end
+
+      #--------------------------------------#
+
       describe '#directory?' do
         it 'expands a pattern into all the combinations of Dir#glob literals' do
           patterns = @path_list.send(:dir_glob_equivalent_patterns, '{file1,file2}.{h,m}')
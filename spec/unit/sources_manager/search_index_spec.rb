@@ -0,0 +1,43 @@
+require File.expand_path('../../../spec_helper', __FILE__)
+
+module Pod
+  describe Source::Manager::SearchIndex do
+    before do
+      @index = Source::Manager::SearchIndex.new(SpecHelper.temporary_directory + 'search_index')
+      @index.write('master',
+                   'AFNetworking' => %w(afnetworking delightful networking),
+                   'Alamofire' => %w(alamofire elegant networking),
+                   'JSONKit' => %w(json jsonkit))
+    end
+
+    it 'tells whether a source is indexed' do
+      @index.should.be.indexed('master')
+      @index.should.not.be.indexed('other')
+    end
+
+    it 'returns the Pods matching all the words of a query' do
+      @index.search(%w(master), [/networking/i]).sort.should == %w(AFNetworking Alamofire)
+      @index.search(%w(master), [/networking/i, /elegant/i]).should == %w(Alamofire)
+      @index.search(%w(master), [/unknown/i]).should.be.empty
+    end
+
+    it 'matches the words of a query across sources' do
+      @index.write('other', 'AFNetworking' => %w(http))
+      @index.search(%w(master other), [/delightful/i, /http/i]).should == %w(AFNetworking)
+      @index.search(%w(master), [/delightful/i, /http/i]).should.be.empty
+    end
+
+    it 'updates the changed Pods only' do
+      @index.update('master', %w(Alamofire JSONKit), 'Alamofire' => %w(alamofire swift))
+      @index.search(%w(master), [/networking/i]).should == %w(AFNetworking)
+      @index.search(%w(master), [/swift/i]).should == %w(Alamofire)
+      @index.search(%w(master), [/json/i]).should.be.empty
+    end
+
+    it 'returns the Pods of a source keyed by word' do
+      index = @index.words_index('master')
+      index['networking'].sort.should == %w(AFNetworking Alamofire)
+      index['jsonkit'].should == %w(JSONKit)
+    end
+  end
+end
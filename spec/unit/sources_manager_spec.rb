@@ -63,6 +63,30 @@ module Pod
         path.should.end_with 'Library/Caches/CocoaPods/search_index.json'
       end
 
+      it 'searches the names of the Pods without the search index' do
+        @sources_manager.expects(:segmented_search_index).never
+        sets = @sources_manager.search_by_name('BananaLib')
+        sets.map(&:name).should.include 'BananaLib'
+      end
+
+      it 'searches the segmented search index for a full text search' do
+        @sources_manager.segmented_search_index.write(@test_source.name, 'BananaLib' => %w(chunky))
+        @sources_manager.stubs(:index_missing_sources)
+        sets = @sources_manager.search_by_name('chunky', true)
+        sets.map(&:name).should == %w(BananaLib)
+      end
+
+      it 'only updates the search index of the changed Pods' do
+        index = @sources_manager.segmented_search_index
+        index.write(@test_source.name, 'BananaLib' => %w(banana), 'JSONKit' => %w(json))
+        @test_source.stubs(:pods_for_specification_paths).returns(%w(BananaLib))
+        @sources_manager.aggregate.stubs(:generate_search_index_for_changes_in_source).
+          returns('banana' => %w(BananaLib), 'chunky' => %w(BananaLib))
+        @sources_manager.update_search_index_if_needed(@test_source => ['Specs/BananaLib/1.0/BananaLib.podspec'])
+        index.search([@test_source.name], [/chunky/i]).should == %w(BananaLib)
+        index.search([@test_source.name], [/json/i]).should == %w(JSONKit)
+      end
+
       describe 'managing sources by URL' do
         describe 'finding or creating a source by URL' do
           it 'returns an existing matching source' do
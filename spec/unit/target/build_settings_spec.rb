@@ -44,6 +44,39 @@ module Pod
 
       #---------------------------------------------------------------------#
 
+      describe '#xcconfig_digest' do
+        def settings_with_xcconfig(xcconfig)
+          settings = BuildSettings.new(stub('Target'))
+          settings.stubs(:xcconfig).returns(Xcodeproj::Config.new(xcconfig))
+          settings
+        end
+
+        it 'is memoized' do
+          settings = settings_with_xcconfig('A' => 'a')
+          settings.xcconfig_digest.should.equal?(settings.xcconfig_digest)
+        end
+
+        it 'does not depend on the order of the settings and of the linker flags' do
+          digest = settings_with_xcconfig('A' => 'a', 'B' => 'b', 'OTHER_LDFLAGS' => '-framework "Foo" -framework "Bar"').xcconfig_digest
+          settings_with_xcconfig('B' => 'b', 'A' => 'a', 'OTHER_LDFLAGS' => '-framework "Bar" -framework "Foo"').xcconfig_digest.should == digest
+        end
+
+        it 'changes whenever the rendered xcconfig changes' do
+          xcconfigs = [
+            { 'A' => 'a' },
+            { 'A' => 'b' },
+            { 'B' => 'a' },
+            { 'A' => 'a', 'OTHER_LDFLAGS' => '-framework "Foo"' },
+            { 'A' => 'a', 'OTHER_LDFLAGS' => '-weak_framework "Foo"' },
+            { 'A' => 'a', 'OTHER_LDFLAGS' => '-l"Foo"' },
+          ]
+          xcconfigs.map { |xcconfig| Xcodeproj::Config.new(xcconfig).to_s }.uniq.size.should == xcconfigs.size
+          xcconfigs.map { |xcconfig| settings_with_xcconfig(xcconfig).xcconfig_digest }.uniq.size.should == xcconfigs.size
+        end
+      end
+
+      #---------------------------------------------------------------------#
+
       describe '::add_developers_frameworks_if_needed' do
         it 'adds the developer frameworks search paths to the xcconfig if SenTestingKit has been detected' do
           xcconfig = BuildSettings.new(stub('Target'))
@@ -0,0 +1,66 @@
+require File.expand_path('../../../spec_helper', __FILE__)
+
+module Pod
+  describe UserInterface::Timings do
+    before do
+      @timings = UserInterface::Timings.new
+    end
+
+    it 'records a complete event for each measured section' do
+      @timings.measure('Outer') { @timings.measure('Inner', 'hook') {} }
+      inner, outer = @timings.events
+      outer['name'].should == 'Outer'
+      outer['cat'].should == 'section'
+      outer['ph'].should == 'X'
+      inner['name'].should == 'Inner'
+      inner['cat'].should == 'hook'
+      (outer['dur'] >= inner['dur']).should.be.true
+      (outer['ts'] <= inner['ts']).should.be.true
+    end
+
+    it 'returns the value of the block' do
+      @timings.measure('Section') { 42 }.should == 42
+    end
+
+    it 'records the allocations and garbage collections of a section' do
+      @timings.measure('Section') { Array.new(100) { 'string'.dup } }
+      args = @timings.events.first['args']
+      (args['allocations'] >= 100).should.be.true
+      args.keys.sort.should == %w(allocations gc_count major_gc_count minor_gc_count)
+    end
+
+    it 'records sections which raise' do
+      should.raise(StandardError) { @timings.measure('Failing') { raise StandardError } }
+      @timings.events.map { |event| event['name'] }.should == ['Failing']
+    end
+
+    it 'removes the colors from the names of the sections' do
+      @timings.measure('Installing'.green) {}
+      @timings.events.first['name'].should == 'Installing'
+    end
+
+    it 'writes the events as a Chrome trace' do
+      @timings.measure('Inner') {}
+      path = temporary_directory + 'timings/trace.json'
+      @timings.write(path)
+      trace = JSON.parse(path.read)
+      trace['traceEvents'].map { |event| event['name'] }.should == ['Inner']
+      trace['otherData']['cocoapods_version'].should == VERSION
+    end
+
+    describe 'in the user interface' do
+      after do
+        UI.timings = nil
+      end
+
+      it 'measures the sections and messages with a block' do
+        UI.timings = @timings
+        UI.section('Analyzing dependencies') do
+          UI.message('- Running pre install hooks') {}
+          UI.message('- Not measured')
+        end
+        @timings.events.map { |event| event['name'] }.should == ['- Running pre install hooks', 'Analyzing dependencies']
+      end
+    end
+  end
+end
@@ -47,6 +47,45 @@ module Pod
 
     #-------------------------------------------------------------------------#
 
+    describe 'Concurrent validation' do
+      it 'validates in forked processes and reports the results in order' do
+        validators = [podspec_path, podspec_path('RestKit', '0.22.0')].map do |path|
+          validator = Validator.new(path, config.sources_manager.master.map(&:url))
+          validator.quick = true
+          validator
+        end
+        reported = []
+        Validator.validate_concurrently(validators, 2) { |validator| reported << validator.spec.name }
+        reported.should == %w(JSONKit RestKit)
+        validators.each { |validator| validator.results.should.not.be.nil }
+      end
+
+      it 'reports the validation directories created in the forked processes' do
+        validators = [podspec_path, podspec_path('RestKit', '0.22.0')].map do |path|
+          validator = Validator.new(path, config.sources_manager.master.map(&:url))
+          validator.define_singleton_method(:validate) do
+            validation_dir
+            @results = []
+          end
+          validator
+        end
+        validation_dirs = []
+        Validator.validate_concurrently(validators, 2) { |validator| validation_dirs << validator.validation_dir }
+        validation_dirs.each { |dir| dir.should.exist }
+        validation_dirs.uniq.count.should == 2
+        validation_dirs.each(&:rmtree)
+      end
+
+      it 'validates in this process with a single job' do
+        validator = Validator.new(podspec_path, config.sources_manager.master.map(&:url))
+        validator.expects(:validate)
+        validator.expects(:fork_validation).never
+        Validator.validate_concurrently([validator], 2)
+      end
+    end
+
+    #-------------------------------------------------------------------------#
+
     describe 'Quick mode' do
       it 'validates a correct podspec' do
         validator = Validator.new(podspec_path, config.sources_manager.master.map(&:url))
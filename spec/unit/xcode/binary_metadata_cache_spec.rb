@@ -0,0 +1,76 @@
+require File.expand_path('../../../spec_helper', __FILE__)
+
+module Pod
+  describe Xcode::BinaryMetadataCache do
+    before do
+      @path = temporary_directory + 'Pods/.project_cache/binary_metadata'
+      @binary = temporary_directory + 'libBinary.a'
+      @binary.write('binary')
+      @cache = Xcode::BinaryMetadataCache.new(@path)
+    end
+
+    after do
+      Xcode::BinaryMetadataCache.shared = nil
+    end
+
+    it 'computes the result only once while the file does not change' do
+      @cache.fetch(:dynamic_binary, @binary) { true }.should.be.true
+      @cache.fetch(:dynamic_binary, @binary) { raise 'Should not be computed again' }.should.be.true
+    end
+
+    it 'computes the result again when the file changes' do
+      @cache.fetch(:dynamic_binary, @binary) { true }
+      @binary.write('changed binary')
+      @cache.fetch(:dynamic_binary, @binary) { false }.should.be.false
+    end
+
+    it 'stores the results of the different kinds separately' do
+      @cache.fetch(:dynamic_binary, @binary) { true }
+      @cache.fetch(:xcframework_plist, @binary) { {} }.should == {}
+    end
+
+    it 'computes the result without storing it if the file does not exist' do
+      missing = temporary_directory + 'Missing.a'
+      @cache.fetch(:dynamic_binary, missing) { true }.should.be.true
+      @cache.fetch(:dynamic_binary, missing) { false }.should.be.false
+    end
+
+    it 'persists the results across installations' do
+      @cache.fetch(:dynamic_binary, @binary) { true }
+      @cache.save!
+      cache = Xcode::BinaryMetadataCache.from_file(@path)
+      cache.fetch(:dynamic_binary, @binary) { raise 'Should not be computed again' }.should.be.true
+    end
+
+    it 'only persists the results which have been used' do
+      other_binary = temporary_directory + 'libOther.a'
+      other_binary.write('other')
+      @cache.fetch(:dynamic_binary, @binary) { true }
+      @cache.fetch(:dynamic_binary, other_binary) { true }
+      @cache.save!
+      cache = Xcode::BinaryMetadataCache.from_file(@path)
+      cache.fetch(:dynamic_binary, @binary) { raise 'Should not be computed again' }
+      cache.save!
+      Xcode::BinaryMetadataCache.from_file(@path).fetch(:dynamic_binary, other_binary) { false }.should.be.false
+    end
+
+    it 'does not write the cache if nothing changed' do
+      @cache.save!
+      @path.should.not.exist
+    end
+
+    it 'ignores an invalid cache file' do
+      @path.dirname.mkpath
+      @path.write('invalid')
+      cache = Xcode::BinaryMetadataCache.from_file(@path)
+      cache.fetch(:dynamic_binary, @binary) { false }.should.be.false
+    end
+
+    it 'computes the results directly when there is no shared cache' do
+      Xcode::BinaryMetadataCache.fetch(:dynamic_binary, @binary) { true }.should.be.true
+      Xcode::BinaryMetadataCache.shared = @cache
+      Xcode::BinaryMetadataCache.fetch(:dynamic_binary, @binary) { true }
+      @cache.fetch(:dynamic_binary, @binary) { raise 'Should not be computed again' }.should.be.true
+    end
+  end
+end